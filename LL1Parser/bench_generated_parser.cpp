@@ -0,0 +1,97 @@
+#include "ll1_grammar.hpp"
+#include "ll1_parser.hpp"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <cstdlib>
+
+using namespace LL1;
+
+// Benchmark: intérprete de tabla frente al parser descendente recursivo generado,
+// sobre el mismo programa V3 y sin acciones semánticas (solo análisis sintáctico).
+
+static std::string buildProgram(int statements) {
+    std::ostringstream program;
+    for (int i = 0; i < statements; ++i) {
+        switch (i % 5) {
+        case 0: program << "let x := " << i << ", y := x * 2 in (x + y) * 3 - f(x, y, 1);\n"; break;
+        case 1: program << "if (a < " << i << " || c != d && b >= 2) a + 1 elif (a == 0) 0 else b * c;\n"; break;
+        case 2: program << "while (i < " << i << ") g(i % 3, \"text\", new Point(i, 2));\n"; break;
+        case 3: program << "function h" << i << "(p, q) => p * q + " << i << " / 2;\n"; break;
+        case 4: program << "{ for (k in range(0, " << i << ")) k * k; z; };\n"; break;
+        }
+    }
+    return program.str();
+}
+
+// `input` es el texto o un TokenBuffer ya extraído (solo análisis sintáctico)
+template <typename Input>
+static double timeParses(LL1Parser& parser, const Input& input, int rounds) {
+    // Silenciar el mensaje de éxito de cada análisis
+    std::ostringstream sink;
+    std::streambuf* oldOut = std::cout.rdbuf(sink.rdbuf());
+
+    auto start = std::chrono::steady_clock::now();
+    bool ok = true;
+    for (int r = 0; r < rounds; ++r) {
+        ok = parser.parse(input) != nullptr && ok;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout.rdbuf(oldOut);
+    if (!ok) {
+        std::cerr << "Benchmark input failed to parse" << std::endl;
+        std::exit(1);
+    }
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char** argv) {
+    std::cout << "Generated Parser Benchmark - Full HULK Grammar V3" << std::endl;
+    std::cout << "=================================================" << std::endl << std::endl;
+
+    // Uso: bench_generated_parser [sentencias] [rondas]
+    int statements = argc > 1 ? std::max(1, std::atoi(argv[1])) : 20000;
+    int rounds = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+    const std::string input = buildProgram(statements);
+
+    auto interpreter = ParserFactory::createFullHulkParserV3();
+    interpreter->setGeneratedParser(nullptr, 0);
+    auto generated = ParserFactory::createFullHulkParserV3();
+    if (!generated->usesGeneratedParser()) {
+        std::cerr << "Generated parser is out of date; run 'make generate-tables'" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Statements: " << statements << " (" << input.size() / 1024 << " KiB)" << std::endl;
+    std::cout << "Rounds:     " << rounds << std::endl << std::endl;
+
+    double interpreted = timeParses(*interpreter, input, rounds);
+    double direct = timeParses(*generated, input, rounds);
+    double megabytes = double(input.size()) * rounds / (1024.0 * 1024.0);
+
+    std::cout << std::setw(14) << "parser" << std::setw(12) << "seconds" << std::setw(10) << "MiB/s" << std::endl;
+    std::cout << std::setw(14) << "interpreter" << std::setw(12) << std::fixed << std::setprecision(3) << interpreted
+              << std::setw(10) << std::setprecision(1) << megabytes / interpreted << std::endl;
+    std::cout << std::setw(14) << "generated" << std::setw(12) << std::setprecision(3) << direct
+              << std::setw(10) << std::setprecision(1) << megabytes / direct << std::endl;
+    std::cout << std::endl << "Speedup: " << std::setprecision(2) << interpreted / direct << "x" << std::endl;
+
+    // Las dos fases por separado: extraer los tokens una vez y analizar solo el buffer
+    TokenBuffer tokens;
+    auto lexStart = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        Lexer(input).tokenizeAll(tokens);
+    }
+    double lexing = std::chrono::duration<double>(std::chrono::steady_clock::now() - lexStart).count();
+    double parsing = timeParses(*generated, tokens, rounds);
+
+    std::cout << std::endl << std::setw(14) << "phase" << std::setw(12) << "seconds" << std::setw(10) << "MiB/s" << std::endl;
+    std::cout << std::setw(14) << "tokenize" << std::setw(12) << std::setprecision(3) << lexing
+              << std::setw(10) << std::setprecision(1) << megabytes / lexing << std::endl;
+    std::cout << std::setw(14) << "parse tokens" << std::setw(12) << std::setprecision(3) << parsing
+              << std::setw(10) << std::setprecision(1) << megabytes / parsing << std::endl;
+
+    return 0;
+}
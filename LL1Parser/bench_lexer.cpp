@@ -0,0 +1,104 @@
+#include "ll1_parser.hpp"
+#include "ll1_parallel_lexer.hpp"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+using namespace LL1;
+
+// Benchmark: Lexer solo con el DFA frente al Lexer con el índice estructural de cada
+// ISA soportada y frente al ParallelLexer, sobre un programa HULK grande (solo análisis
+// léxico).
+
+static std::string buildProgram(int statements) {
+    std::ostringstream program;
+    for (int i = 0; i < statements; ++i) {
+        switch (i % 4) {
+        case 0: program << "let variable_" << i << " := " << i << ".25, otra_variable := variable_" << i << " * 2 in\n"; break;
+        case 1: program << "    print(\"una cadena bastante larga con \\\"escapes\\\" numero " << i << "\");\n"; break;
+        case 2: program << "function funcion_" << i << "(parametro, otro) => parametro @@ otro;    // " << i << "\n"; break;
+        case 3: program << "        if (contador_" << i << " <= 123456789) contador + 1 else contador;\n\n"; break;
+        }
+    }
+    return program.str();
+}
+
+// Segundos para recorrer la entrada `rounds` veces; `isa` solo cuenta si `indexed`
+static double timeLexer(const std::string& input, int rounds, bool indexed, StructuralIndex::Isa isa, size_t& tokens) {
+    auto start = std::chrono::steady_clock::now();
+    tokens = 0;
+    for (int r = 0; r < rounds; ++r) {
+        Lexer lexer(input);
+        if (indexed) lexer.useStructuralIndex(isa);
+        while (lexer.nextToken().kind != TokenKind::END_OF_INPUT) ++tokens;
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char** argv) {
+    std::cout << "Lexer Benchmark - DFA vs. Structural Index" << std::endl;
+    std::cout << "==========================================" << std::endl << std::endl;
+
+    // Uso: bench_lexer [sentencias] [rondas]
+    int statements = argc > 1 ? std::max(1, std::atoi(argv[1])) : 50000;
+    int rounds = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+    const std::string input = buildProgram(statements);
+    double megabytes = double(input.size()) * rounds / (1024.0 * 1024.0);
+
+    std::cout << "Statements: " << statements << " (" << input.size() / 1024 << " KiB)" << std::endl;
+    std::cout << "Rounds:     " << rounds << std::endl << std::endl;
+
+    size_t expectedTokens = 0;
+    double baseline = timeLexer(input, rounds, false, StructuralIndex::Isa::SCALAR, expectedTokens);
+
+    std::cout << std::setw(14) << "lexer" << std::setw(12) << "seconds" << std::setw(10) << "MiB/s"
+              << std::setw(10) << "speedup" << std::endl;
+    std::cout << std::setw(14) << "dfa" << std::setw(12) << std::fixed << std::setprecision(3) << baseline
+              << std::setw(10) << std::setprecision(1) << megabytes / baseline << std::setw(10) << "1.00x" << std::endl;
+
+    for (auto isa : {StructuralIndex::Isa::SCALAR, StructuralIndex::Isa::SSE2, StructuralIndex::Isa::AVX2}) {
+        if (!StructuralIndex::isSupported(isa)) continue;
+        size_t tokens = 0;
+        double seconds = timeLexer(input, rounds, true, isa, tokens);
+        if (tokens != expectedTokens) {
+            std::cerr << "Token count differs with the " << StructuralIndex::isaName(isa) << " index" << std::endl;
+            return 1;
+        }
+        std::cout << std::setw(14) << (std::string("index/") + StructuralIndex::isaName(isa))
+                  << std::setw(12) << std::setprecision(3) << seconds
+                  << std::setw(10) << std::setprecision(1) << megabytes / seconds
+                  << std::setw(9) << std::setprecision(2) << baseline / seconds << "x" << std::endl;
+    }
+
+    // Buffer completo: en secuencia (tokenizeAll) y en paralelo con 1, 2, 4... hilos
+    std::cout << std::endl << std::setw(14) << "tokenize" << std::setw(12) << "seconds" << std::setw(10) << "MiB/s"
+              << std::setw(10) << "chunks" << std::endl;
+    TokenBuffer tokens;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) Lexer(input).tokenizeAll(tokens);
+    double sequential = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << std::setw(14) << "sequential" << std::setw(12) << std::setprecision(3) << sequential
+              << std::setw(10) << std::setprecision(1) << megabytes / sequential << std::setw(10) << 1 << std::endl;
+
+    // Trozos más pequeños que los de por defecto para que la entrada se reparta
+    const unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= std::max(4u, maxThreads); threads *= 2) {
+        ParallelLexer lexer(threads, 64 * 1024);
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; ++r) lexer.tokenize(input, tokens);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (tokens.size() != expectedTokens / rounds + 1) {
+            std::cerr << "Token count differs with " << threads << " lexer threads" << std::endl;
+            return 1;
+        }
+        std::cout << std::setw(14) << (std::to_string(threads) + " threads") << std::setw(12) << std::setprecision(3) << seconds
+                  << std::setw(10) << std::setprecision(1) << megabytes / seconds
+                  << std::setw(10) << lexer.lastStats().chunks << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include "ll1_parser.hpp"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+
+using namespace LL1;
+
+// Benchmark: LL1Parser::parseMany sobre un corpus de muchos programas pequeños, con 1,
+// 2, 4... hilos. La gramática y las tablas se construyen una sola vez para todos.
+
+static std::vector<std::string> buildCorpus(int programs) {
+    std::vector<std::string> corpus;
+    for (int p = 0; p < programs; ++p) {
+        std::ostringstream program;
+        const int statements = 5 + p % 40;
+        for (int i = 0; i < statements; ++i) {
+            switch ((p + i) % 4) {
+            case 0: program << "let x := " << i << ", y := x * 2 in (x + y) * 3 - f(x, y, 1);\n"; break;
+            case 1: program << "if (a < " << i << " || c != d && b >= 2) a + 1 elif (a == 0) 0 else b * c;\n"; break;
+            case 2: program << "while (i < " << i << ") g(i % 3, \"text\", new Point(i, 2));\n"; break;
+            case 3: program << "function h" << i << "(p, q) => p * q + " << i << " / 2;\n"; break;
+            }
+        }
+        corpus.push_back(program.str());
+    }
+    return corpus;
+}
+
+int main(int argc, char** argv) {
+    std::cout << "Batch Parse Benchmark - Full HULK Grammar V3" << std::endl;
+    std::cout << "============================================" << std::endl << std::endl;
+    
+    // Uso: bench_parse_many [programas] [max_hilos]
+    int programs = argc > 1 ? std::max(1, std::atoi(argv[1])) : 5000;
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 2) maxThreads = std::max(1, std::atoi(argv[2]));
+    
+    const std::vector<std::string> corpus = buildCorpus(programs);
+    std::vector<ParseSource> sources;
+    size_t bytes = 0;
+    for (const std::string& program : corpus) {
+        sources.push_back(ParseSource::fromText(program));
+        bytes += program.size();
+    }
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::cout << "Programs:    " << programs << " (" << bytes / 1024 << " KiB)" << std::endl;
+    std::cout << "Max threads: " << maxThreads << std::endl << std::endl;
+    
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "seconds"
+              << std::setw(14) << "programs/s" << std::setw(12) << "speedup" << std::endl;
+    
+    double baseSeconds = 0;
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<ParseResult> results = parser->parseMany(sources, threads);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        
+        for (const ParseResult& result : results) {
+            if (!result.program) {
+                std::cerr << "Benchmark input failed to parse: " << result.diagnostics;
+                return 1;
+            }
+        }
+        if (threads == 1) baseSeconds = seconds;
+        
+        std::cout << std::setw(8) << threads << std::setw(12) << std::fixed << std::setprecision(3) << seconds
+                  << std::setw(14) << std::setprecision(0) << programs / seconds
+                  << std::setw(11) << std::setprecision(2) << baseSeconds / seconds << "x" << std::endl;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "ll1_grammar.hpp"
+#include "ll1_parser.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+
+using namespace LL1;
+
+// Benchmark: N hilos consultando la misma Grammar (sin clonarla).
+// Todos arrancan a la vez sobre una gramática sin analizar, de modo que el primer
+// getParseTable() compite por la inicialización perezosa; después cada consulta
+// pasa por el camino rápido (una carga acquire) y la tabla densa.
+
+static const size_t LOOKUPS_PER_THREAD = 20000000;
+
+static double runThreads(Grammar& grammar, unsigned threadCount, long long& checksum) {
+    std::vector<std::thread> threads;
+    std::vector<long long> sums(threadCount, 0);
+    
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&grammar, &sums, t] {
+            grammar.getParseTable();
+            const SymbolId rows = static_cast<SymbolId>(grammar.getSymbolTable().nonTerminalCount());
+            const SymbolId columns = static_cast<SymbolId>(grammar.getSymbolTable().terminalCount());
+            
+            long long sum = 0;
+            SymbolId nonTerminal = static_cast<SymbolId>(t % rows);
+            SymbolId terminal = 0;
+            for (size_t i = 0; i < LOOKUPS_PER_THREAD; ++i) {
+                sum += grammar.getDenseParseTable().lookup(nonTerminal, terminal);
+                if (++terminal == columns) {
+                    terminal = 0;
+                    if (++nonTerminal == rows) nonTerminal = 0;
+                }
+            }
+            sums[t] = sum;
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    auto end = std::chrono::steady_clock::now();
+    
+    checksum = 0;
+    for (long long sum : sums) checksum += sum;
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char** argv) {
+    std::cout << "Shared Grammar Benchmark - Full HULK Grammar V3" << std::endl;
+    std::cout << "===============================================" << std::endl << std::endl;
+    
+    // Uso: bench_shared_grammar [max_hilos]
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 1) maxThreads = std::max(1, std::atoi(argv[1]));
+    std::cout << "Lookups per thread: " << LOOKUPS_PER_THREAD << std::endl;
+    std::cout << "Max threads:        " << maxThreads << std::endl << std::endl;
+    
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "seconds"
+              << std::setw(18) << "Mlookups/s" << std::setw(12) << "speedup" << std::endl;
+    
+    double baseThroughput = 0;
+    long long expected = 0;
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        // Gramática nueva en cada ronda: la inicialización perezosa también se mide
+        Grammar grammar = ParserFactory::createFullHulkGrammarV3();
+        
+        long long checksum = 0;
+        double seconds = runThreads(grammar, threads, checksum);
+        double throughput = threads * LOOKUPS_PER_THREAD / seconds / 1e6;
+        if (threads == 1) {
+            baseThroughput = throughput;
+            expected = checksum;
+        } else if (checksum == 0 || expected == 0) {
+            std::cerr << "Unexpected empty parse table" << std::endl;
+            return 1;
+        }
+        
+        std::cout << std::setw(8) << threads << std::setw(14) << std::fixed << std::setprecision(3) << seconds
+                  << std::setw(18) << std::setprecision(1) << throughput
+                  << std::setw(11) << std::setprecision(2) << throughput / baseThroughput << "x" << std::endl;
+    }
+    
+    return 0;
+}
@@ -284,7 +284,8 @@ Grammar ParserFactory::createFullHulkGrammar() {
 }
 
 std::unique_ptr<LL1Parser> ParserFactory::createFullHulkParser() {
-    Grammar grammar = createFullHulkGrammar();
+    // La gramática se analiza una sola vez y se comparte entre todos los parsers
+    static const auto grammar = CompiledGrammar::compile(createFullHulkGrammar());
     auto parser = std::make_unique<LL1Parser>(grammar);
     // setupFullHulkSemanticActions(*parser); // TODO: Implementar acciones semánticas
     return parser;
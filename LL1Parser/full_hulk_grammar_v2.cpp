@@ -244,7 +244,8 @@ Grammar ParserFactory::createFullHulkGrammarV2() {
 }
 
 std::unique_ptr<LL1Parser> ParserFactory::createFullHulkParserV2() {
-    Grammar grammar = createFullHulkGrammarV2();
+    // La gramática se analiza una sola vez y se comparte entre todos los parsers
+    static const auto grammar = CompiledGrammar::compile(createFullHulkGrammarV2());
     auto parser = std::make_unique<LL1Parser>(grammar);
     // setupFullHulkSemanticActions(*parser); // TODO: Implementar cuando sea LL(1)
     return parser;
@@ -1,7 +1,10 @@
 #include "ll1_parser.hpp"
+#include "hulk_v3_tables.hpp"
+#include "hulk_v3_parser.hpp"
 #include "semantic_nodes.hpp"
 #include "../ast.hpp"
 #include <iostream>
+#include <cstdlib>
 
 namespace LL1 {
 
@@ -196,16 +199,37 @@ Grammar ParserFactory::createFullHulkGrammarV3() {
     return grammar;
 }
 
+std::shared_ptr<const CompiledGrammar> ParserFactory::getCompiledFullHulkGrammarV3() {
+    // Se resuelve una sola vez (inicialización estática segura entre hilos).
+    // Si la gramática coincide con las tablas generadas (hulk_v3_tables.hpp) se usan
+    // sin ningún análisis; si no, se analiza, usando la caché binaria de LL1_GRAMMAR_CACHE.
+    static const auto compiled = [] {
+        Grammar grammar = createFullHulkGrammarV3();
+        if (grammar.contentHash() == HulkV3::GRAMMAR_HASH) {
+            if (auto generated = HulkV3::compiledGrammar()) return generated;
+        } else {
+            std::cerr << "Warning: hulk_v3_tables.hpp is out of date; run 'make generate-tables'" << std::endl;
+        }
+        
+        const char* cachePath = std::getenv("LL1_GRAMMAR_CACHE");
+        if (cachePath && *cachePath) {
+            return CompiledGrammar::compileCached(std::move(grammar), cachePath);
+        }
+        return CompiledGrammar::compile(std::move(grammar));
+    }();
+    return compiled;
+}
+
 std::unique_ptr<LL1Parser> ParserFactory::createFullHulkParserV3() {
-    Grammar grammar = createFullHulkGrammarV3();
-    auto parser = std::make_unique<LL1Parser>(grammar);
+    auto parser = std::make_unique<LL1Parser>(getCompiledFullHulkGrammarV3());
+    parser->setGeneratedParser(HulkV3::parse, HulkV3::GRAMMAR_HASH, HulkV3::parseFrom); // si las tablas generadas están al día
     // setupFullHulkSemanticActionsV3(*parser); // Deshabilitado temporalmente
     return parser;
 }
 
 std::unique_ptr<LL1Parser> ParserFactory::createFullHulkParserV4() {
-    Grammar grammar = createFullHulkGrammarV3();
-    auto parser = std::make_unique<LL1Parser>(grammar);
+    auto parser = std::make_unique<LL1Parser>(getCompiledFullHulkGrammarV3());
+    parser->setGeneratedParser(HulkV3::parse, HulkV3::GRAMMAR_HASH, HulkV3::parseFrom); // si las tablas generadas están al día
     setupCompleteSemanticActionsV4(*parser); // Habilitar acciones semánticas V4
     return parser;
 }
@@ -0,0 +1,63 @@
+#include "ll1_parser.hpp"
+#include "ll1_codegen.hpp"
+#include "ll1_lexer_generator.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace LL1;
+
+// Generador del analizador léxico: lee una especificación de tokens (hulk_tokens.spec),
+// construye el DFA mínimo y escribe sus tablas para Lexer::nextToken.
+// Uso: generate_lexer <spec> <namespace> <tablas.hpp>
+
+// Cada regla debe nombrar una clase de token del Lexer o ser "skip"
+bool checkRuleNames(const std::vector<TokenRule>& rules) {
+    bool ok = true;
+    for (const auto& rule : rules) {
+        bool known = rule.name == "skip";
+        for (size_t k = 1; k < static_cast<size_t>(TokenKind::COUNT) && !known; ++k) {
+            known = tokenKindSymbol(static_cast<TokenKind>(k)).name == rule.name;
+        }
+        if (!known) {
+            std::cerr << "Token spec line " << rule.line << ": unknown token kind " << rule.name << std::endl;
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <spec> <namespace> <tables.hpp>" << std::endl;
+        return 1;
+    }
+    
+    const std::string specPath = argv[1];
+    std::ifstream spec(specPath);
+    if (!spec) {
+        std::cerr << "Could not open " << specPath << std::endl;
+        return 1;
+    }
+    
+    std::vector<TokenRule> rules;
+    if (!LexerGenerator::parseSpec(spec, rules) || !checkRuleNames(rules)) return 1;
+    
+    try {
+        LexerDfa dfa = LexerGenerator::buildDfa(rules);
+        KeywordTable keywords = LexerGenerator::buildKeywordTable(rules, dfa);
+        std::cout << rules.size() << " rules -> " << dfa.stateCount() << " states, "
+                  << dfa.classCount << " byte classes, " << keywords.slots.size() << " keyword slots" << std::endl;
+        
+        std::ostringstream tables;
+        const std::string source = specPath.substr(specPath.find_last_of('/') + 1);
+        LexerGenerator::writeTablesHeader(dfa, keywords, rules, argv[2], source, tables);
+        if (!CodeGenerator::writeFileIfChanged(argv[3], tables.str())) return 1;
+    
+    } catch (const std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include "ll1_parser.hpp"
+#include "ll1_codegen.hpp"
+#include <functional>
+#include <iostream>
+#include <sstream>
+
+using namespace LL1;
+
+// Generador de tablas estáticas: compila una gramática de ParserFactory y escribe
+// un encabezado con sus enums, tabla de predicción y producciones aplanadas y,
+// opcionalmente, otro con un parser descendente recursivo especializado.
+// Uso: generate_tables <gramática> <namespace> <tablas.hpp> [parser.hpp]
+
+struct GrammarSource {
+    const char* name;
+    const char* description;
+    std::function<Grammar()> create;
+};
+
+const GrammarSource GRAMMARS[] = {
+    {"simple", "ParserFactory::createSimpleHulkGrammar()", ParserFactory::createSimpleHulkGrammar},
+    {"intermediate", "ParserFactory::createIntermediateHulkGrammar()", ParserFactory::createIntermediateHulkGrammar},
+    {"full", "ParserFactory::createFullHulkGrammar()", ParserFactory::createFullHulkGrammar},
+    {"v2", "ParserFactory::createFullHulkGrammarV2()", ParserFactory::createFullHulkGrammarV2},
+    {"v3", "ParserFactory::createFullHulkGrammarV3()", ParserFactory::createFullHulkGrammarV3},
+};
+
+int main(int argc, char* argv[]) {
+    if (argc != 4 && argc != 5) {
+        std::cerr << "Usage: " << argv[0] << " <grammar> <namespace> <tables.hpp> [parser.hpp]" << std::endl;
+        std::cerr << "Grammars:";
+        for (const auto& source : GRAMMARS) std::cerr << " " << source.name;
+        std::cerr << std::endl;
+        return 1;
+    }
+    
+    const std::string grammarName = argv[1];
+    const GrammarSource* selected = nullptr;
+    for (const auto& source : GRAMMARS) {
+        if (grammarName == source.name) selected = &source;
+    }
+    if (!selected) {
+        std::cerr << "Unknown grammar: " << grammarName << std::endl;
+        return 1;
+    }
+    
+    auto compiled = CompiledGrammar::compile(selected->create());
+    if (!compiled->isLL1()) {
+        std::cerr << "Grammar " << grammarName << " is not LL(1); refusing to generate tables" << std::endl;
+        return 1;
+    }
+    
+    const std::string tablesPath = argv[3];
+    std::ostringstream tables;
+    CodeGenerator::writeTablesHeader(*compiled, argv[2], selected->description, tables);
+    if (!CodeGenerator::writeFileIfChanged(tablesPath, tables.str())) return 1;
+    
+    if (argc == 5) {
+        // El parser incluye el encabezado de tablas por su nombre, junto a él
+        const std::string tablesInclude = tablesPath.substr(tablesPath.find_last_of('/') + 1);
+        std::ostringstream parser;
+        CodeGenerator::writeRecursiveDescentParser(*compiled, argv[2], tablesInclude, selected->description, parser);
+        if (!CodeGenerator::writeFileIfChanged(argv[4], parser.str())) return 1;
+    }
+    
+    return 0;
+}
@@ -245,7 +245,8 @@ void ParserFactory::setupHulkSemanticActions(LL1Parser& parser) {
 }
 
 std::unique_ptr<LL1Parser> ParserFactory::createHulkParser() {
-    Grammar grammar = createHulkGrammar();
+    // La gramática se analiza una sola vez y se comparte entre todos los parsers
+    static const auto grammar = CompiledGrammar::compile(createHulkGrammar());
     auto parser = std::make_unique<LL1Parser>(grammar);
     setupHulkSemanticActions(*parser);
     return parser;
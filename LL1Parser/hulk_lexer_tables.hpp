@@ -0,0 +1,192 @@
+// Generado por generate_lexer a partir de hulk_tokens.spec.
+// No editar a mano: regenerar con 'make generate-tables'.
+#pragma once
+
+#include "ll1_parser.hpp"
+#include <cstring>
+
+namespace LL1 {
+namespace HulkLexer {
+
+// Valores de ACCEPT que no son una clase de token
+inline constexpr std::uint8_t NO_TOKEN = 0xFF;     // estado no final
+inline constexpr std::uint8_t SKIP_TOKEN = 0xFE;   // regla 'skip': se descarta
+
+inline constexpr unsigned STATE_COUNT = 40;
+inline constexpr unsigned CLASS_COUNT = 28;
+inline constexpr unsigned DEAD_STATE = 0;
+inline constexpr unsigned START_STATE = 1;
+
+// Clase de equivalencia de cada byte
+inline constexpr std::uint8_t BYTE_CLASS[256] = {
+     0,  1,  1,  1,  1,  1,  1,  1,  1,  2,  2,  2,  2,  2,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     2,  3,  4,  1,  1,  5,  6,  1,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 17, 18, 19, 20,  1,
+    21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,  1, 23,  1, 24, 22,
+     1, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 25, 26, 27,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+};
+
+// TRANSITIONS[estado][clase] -> estado siguiente (DEAD_STATE si no hay)
+inline constexpr std::uint8_t TRANSITIONS[STATE_COUNT][CLASS_COUNT] = {
+    /*   0 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*   1 */ { 0,  0,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,  0, 23, 24, 25, 26},
+    /*   2 */ { 0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*   3 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*   4 */ { 0,  4,  4,  4, 28,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4, 29,  4,  4,  4,  4},
+    /*   5 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*   6 */ { 0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*   7 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*   8 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*   9 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  10 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  11 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  12 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  13 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  14 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  15 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  16 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  17 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  18 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  19 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34, 35,  0,  0,  0,  0,  0,  0,  0},
+    /*  20 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  21 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 37,  0,  0,  0,  0,  0,  0},
+    /*  22 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,  0,  0,  0, 22,  0,  0,  0,  0,  0},
+    /*  23 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  24 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  25 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38,  0},
+    /*  26 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  27 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  28 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  29 */ { 4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4},
+    /*  30 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  31 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  32 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  33 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  34 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  35 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  36 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  37 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  38 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  39 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+};
+
+// Token aceptado en cada estado: TokenKind, NO_TOKEN o SKIP_TOKEN
+inline constexpr std::uint8_t ACCEPT[STATE_COUNT] = {
+    /*   0 */ NO_TOKEN,
+    /*   1 */ NO_TOKEN,
+    /*   2 */ SKIP_TOKEN,
+    /*   3 */ NO_TOKEN,
+    /*   4 */ std::uint8_t(TokenKind::STRING),
+    /*   5 */ std::uint8_t(TokenKind::MOD),
+    /*   6 */ NO_TOKEN,
+    /*   7 */ std::uint8_t(TokenKind::LPAREN),
+    /*   8 */ std::uint8_t(TokenKind::RPAREN),
+    /*   9 */ std::uint8_t(TokenKind::MULT),
+    /*  10 */ std::uint8_t(TokenKind::PLUS),
+    /*  11 */ std::uint8_t(TokenKind::COMMA),
+    /*  12 */ std::uint8_t(TokenKind::MINUS),
+    /*  13 */ std::uint8_t(TokenKind::DOT),
+    /*  14 */ std::uint8_t(TokenKind::DIV),
+    /*  15 */ std::uint8_t(TokenKind::NUMBER),
+    /*  16 */ NO_TOKEN,
+    /*  17 */ std::uint8_t(TokenKind::SEMICOLON),
+    /*  18 */ std::uint8_t(TokenKind::LESS_THAN),
+    /*  19 */ std::uint8_t(TokenKind::ASSIGN),
+    /*  20 */ std::uint8_t(TokenKind::GREATER_THAN),
+    /*  21 */ NO_TOKEN,
+    /*  22 */ std::uint8_t(TokenKind::IDENT),
+    /*  23 */ std::uint8_t(TokenKind::POW),
+    /*  24 */ std::uint8_t(TokenKind::LBRACE),
+    /*  25 */ NO_TOKEN,
+    /*  26 */ std::uint8_t(TokenKind::RBRACE),
+    /*  27 */ std::uint8_t(TokenKind::NEQ),
+    /*  28 */ std::uint8_t(TokenKind::STRING),
+    /*  29 */ std::uint8_t(TokenKind::STRING),
+    /*  30 */ std::uint8_t(TokenKind::AND),
+    /*  31 */ NO_TOKEN,
+    /*  32 */ std::uint8_t(TokenKind::ASSIGN_DESTRUCT),
+    /*  33 */ std::uint8_t(TokenKind::LE),
+    /*  34 */ std::uint8_t(TokenKind::EQ),
+    /*  35 */ std::uint8_t(TokenKind::ARROW),
+    /*  36 */ std::uint8_t(TokenKind::GE),
+    /*  37 */ std::uint8_t(TokenKind::CONCAT),
+    /*  38 */ std::uint8_t(TokenKind::OR),
+    /*  39 */ std::uint8_t(TokenKind::NUMBER),
+};
+
+// Palabras reservadas: el DFA las reconoce como KEYWORD_HOST y se distinguen con un
+// hash perfecto (keywordSlot, comprobado por el generador) sobre la longitud y los
+// caracteres primero, segundo y último, y una sola comparación sin copiar el lexema
+inline constexpr std::uint8_t KEYWORD_HOST = std::uint8_t(TokenKind::IDENT);
+inline constexpr size_t KEYWORD_MIN_LENGTH = 2;
+inline constexpr size_t KEYWORD_MAX_LENGTH = 8;
+
+struct Keyword {
+    const char* text;
+    std::uint8_t length;
+    std::uint8_t kind;
+};
+
+inline constexpr Keyword KEYWORDS[32] = {
+    /*  0 */ {"self", 4, std::uint8_t(TokenKind::SELF)},
+    /*  1 */ {"in", 2, std::uint8_t(TokenKind::IN)},
+    /*  2 */ {"new", 3, std::uint8_t(TokenKind::NEW)},
+    /*  3 */ {"", 0, KEYWORD_HOST},
+    /*  4 */ {"for", 3, std::uint8_t(TokenKind::FOR)},
+    /*  5 */ {"", 0, KEYWORD_HOST},
+    /*  6 */ {"", 0, KEYWORD_HOST},
+    /*  7 */ {"function", 8, std::uint8_t(TokenKind::FUNCTION)},
+    /*  8 */ {"let", 3, std::uint8_t(TokenKind::LET)},
+    /*  9 */ {"", 0, KEYWORD_HOST},
+    /* 10 */ {"", 0, KEYWORD_HOST},
+    /* 11 */ {"", 0, KEYWORD_HOST},
+    /* 12 */ {"while", 5, std::uint8_t(TokenKind::WHILE)},
+    /* 13 */ {"else", 4, std::uint8_t(TokenKind::ELSE)},
+    /* 14 */ {"", 0, KEYWORD_HOST},
+    /* 15 */ {"inherits", 8, std::uint8_t(TokenKind::INHERITS)},
+    /* 16 */ {"", 0, KEYWORD_HOST},
+    /* 17 */ {"", 0, KEYWORD_HOST},
+    /* 18 */ {"", 0, KEYWORD_HOST},
+    /* 19 */ {"base", 4, std::uint8_t(TokenKind::BASE)},
+    /* 20 */ {"", 0, KEYWORD_HOST},
+    /* 21 */ {"elif", 4, std::uint8_t(TokenKind::ELIF)},
+    /* 22 */ {"", 0, KEYWORD_HOST},
+    /* 23 */ {"", 0, KEYWORD_HOST},
+    /* 24 */ {"false", 5, std::uint8_t(TokenKind::FALSE)},
+    /* 25 */ {"if", 2, std::uint8_t(TokenKind::IF)},
+    /* 26 */ {"true", 4, std::uint8_t(TokenKind::TRUE)},
+    /* 27 */ {"", 0, KEYWORD_HOST},
+    /* 28 */ {"", 0, KEYWORD_HOST},
+    /* 29 */ {"type", 4, std::uint8_t(TokenKind::TYPE)},
+    /* 30 */ {"", 0, KEYWORD_HOST},
+    /* 31 */ {"", 0, KEYWORD_HOST},
+};
+
+// Requiere KEYWORD_MIN_LENGTH <= length <= KEYWORD_MAX_LENGTH
+constexpr size_t keywordSlot(const char* text, size_t length) {
+    return (length +
+            size_t(static_cast<unsigned char>(text[0])) +
+            size_t(static_cast<unsigned char>(text[1])) * 5 +
+            size_t(static_cast<unsigned char>(text[length - 1])) * 8) & 31;
+}
+
+// Clase de token de un lexema que el DFA aceptó como KEYWORD_HOST
+inline std::uint8_t classifyKeyword(const char* text, size_t length) {
+    if (length < KEYWORD_MIN_LENGTH || length > KEYWORD_MAX_LENGTH) return KEYWORD_HOST;
+    const Keyword& keyword = KEYWORDS[keywordSlot(text, length)];
+    return keyword.length == length && std::memcmp(keyword.text, text, length) == 0 ? keyword.kind : KEYWORD_HOST;
+}
+
+} // namespace HulkLexer
+} // namespace LL1
@@ -0,0 +1,65 @@
+# Especificación de tokens de HULK ('make generate-tables' genera hulk_lexer_tables.hpp)
+#
+# Cada línea es "NOMBRE patrón". NOMBRE es una clase de token (TokenKind) o "skip"
+# para lo que se descarta. Un patrón entre comillas simples es texto literal; si no,
+# es una expresión regular sobre bytes con | * + ? ( ) . [a-z] [^...] y los escapes
+# \n \t \r \v \f \0 \xHH (cualquier otro carácter escapado se toma literal).
+# Gana la coincidencia más larga y, a igual longitud, la regla que aparece antes.
+#
+# "keyword NOMBRE 'texto'" declara una palabra reservada. No entra en el DFA: el
+# lexema se reconoce con la regla de IDENT y después se busca en un hash perfecto.
+
+skip            [ \t\n\v\f\r]+
+
+# Literales. Una cadena sin comilla de cierre llega hasta el final de la entrada o
+# hasta el primer byte nulo, y puede acabar en '\'.
+NUMBER          [0-9]+(\.[0-9]+)?
+STRING          "([^"\\\0]|\\.)*["\\]?
+
+# Palabras reservadas
+keyword LET      'let'
+keyword IN       'in'
+keyword IF       'if'
+keyword ELSE     'else'
+keyword ELIF     'elif'
+keyword WHILE    'while'
+keyword FOR      'for'
+keyword FUNCTION 'function'
+keyword TYPE     'type'
+keyword INHERITS 'inherits'
+keyword NEW      'new'
+keyword SELF     'self'
+keyword BASE     'base'
+keyword TRUE     'true'
+keyword FALSE    'false'
+
+IDENT           [A-Za-z_][A-Za-z0-9_]*
+
+# Operadores de dos caracteres
+ASSIGN_DESTRUCT ':='
+EQ              '=='
+NEQ             '!='
+LE              '<='
+GE              '>='
+AND             '&&'
+OR              '||'
+CONCAT          '@@'
+ARROW           '=>'
+
+# Operadores y signos de un carácter
+PLUS            '+'
+MINUS           '-'
+MULT            '*'
+DIV             '/'
+MOD             '%'
+POW             '^'
+LESS_THAN       '<'
+GREATER_THAN    '>'
+ASSIGN          '='
+LPAREN          '('
+RPAREN          ')'
+LBRACE          '{'
+RBRACE          '}'
+COMMA           ','
+SEMICOLON       ';'
+DOT             '.'
@@ -0,0 +1,918 @@
+// Generado por generate_tables a partir de ParserFactory::createFullHulkGrammarV3().
+// No editar a mano: regenerar con 'make generate-tables'.
+//
+// Parser descendente recursivo equivalente al intérprete de LL1Parser::parseInternal:
+// misma secuencia de acciones semánticas, mismos terminales consumidos y mismos errores.
+#pragma once
+
+#include "ll1_parser.hpp"
+#include "hulk_v3_tables.hpp"
+#include <stdexcept>
+
+namespace LL1 {
+namespace HulkV3 {
+namespace RecursiveDescent {
+
+inline void parse_program(ParseContext& ctx);
+inline void parse_stmt_list(ParseContext& ctx);
+inline void parse_stmt(ParseContext& ctx);
+inline void parse_decl(ParseContext& ctx);
+inline void parse_let_expr(ParseContext& ctx);
+inline void parse_if_expr(ParseContext& ctx);
+inline void parse_while_expr(ParseContext& ctx);
+inline void parse_for_expr(ParseContext& ctx);
+inline void parse_block_expr(ParseContext& ctx);
+inline void parse_or_expr(ParseContext& ctx);
+inline void parse_function_decl(ParseContext& ctx);
+inline void parse_and_expr(ParseContext& ctx);
+inline void parse_or_expr_prime(ParseContext& ctx);
+inline void parse_eq_expr(ParseContext& ctx);
+inline void parse_and_expr_prime(ParseContext& ctx);
+inline void parse_rel_expr(ParseContext& ctx);
+inline void parse_eq_expr_prime(ParseContext& ctx);
+inline void parse_arith_expr(ParseContext& ctx);
+inline void parse_rel_expr_prime(ParseContext& ctx);
+inline void parse_add_expr(ParseContext& ctx);
+inline void parse_mult_expr(ParseContext& ctx);
+inline void parse_add_expr_prime(ParseContext& ctx);
+inline void parse_primary_expr(ParseContext& ctx);
+inline void parse_mult_expr_prime(ParseContext& ctx);
+inline void parse_ident_suffix(ParseContext& ctx);
+inline void parse_arg_list(ParseContext& ctx);
+inline void parse_binding_list(ParseContext& ctx);
+inline void parse_else_part(ParseContext& ctx);
+inline void parse_param_list(ParseContext& ctx);
+inline void parse_function_body(ParseContext& ctx);
+inline void parse_param_list_prime(ParseContext& ctx);
+inline void parse_arg_list_prime(ParseContext& ctx);
+inline void parse_binding(ParseContext& ctx);
+inline void parse_binding_list_prime(ParseContext& ctx);
+
+inline void parse_program(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_END_OF_INPUT:
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+    case T_LET:
+    case T_IF:
+    case T_WHILE:
+    case T_FOR:
+    case T_LBRACE:
+    case T_FUNCTION:
+        ctx.predict(P_PROGRAM__STMT_LIST);
+        parse_stmt_list(ctx);
+        return;
+    default:
+        ctx.noRule(NT_PROGRAM);
+    }
+}
+
+inline void parse_stmt_list(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_NUMBER:
+        case T_STRING:
+        case T_TRUE:
+        case T_FALSE:
+        case T_IDENT:
+        case T_LPAREN:
+        case T_NEW:
+        case T_LET:
+        case T_IF:
+        case T_WHILE:
+        case T_FOR:
+        case T_LBRACE:
+        case T_FUNCTION:
+            ctx.predict(P_STMT_LIST__STMT_STMT_LIST);
+            parse_stmt(ctx);
+            continue;
+        case T_END_OF_INPUT:
+        case T_RBRACE:
+            ctx.predict(P_STMT_LIST__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_STMT_LIST);
+        }
+    }
+}
+
+inline void parse_stmt(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_FUNCTION:
+        ctx.predict(P_STMT__DECL);
+        parse_decl(ctx);
+        return;
+    case T_LET:
+        ctx.predict(P_STMT__LET_EXPR_SEMICOLON);
+        parse_let_expr(ctx);
+        ctx.match(T_SEMICOLON);
+        return;
+    case T_IF:
+        ctx.predict(P_STMT__IF_EXPR_SEMICOLON);
+        parse_if_expr(ctx);
+        ctx.match(T_SEMICOLON);
+        return;
+    case T_WHILE:
+        ctx.predict(P_STMT__WHILE_EXPR_SEMICOLON);
+        parse_while_expr(ctx);
+        ctx.match(T_SEMICOLON);
+        return;
+    case T_FOR:
+        ctx.predict(P_STMT__FOR_EXPR_SEMICOLON);
+        parse_for_expr(ctx);
+        ctx.match(T_SEMICOLON);
+        return;
+    case T_LBRACE:
+        ctx.predict(P_STMT__BLOCK_EXPR_SEMICOLON);
+        parse_block_expr(ctx);
+        ctx.match(T_SEMICOLON);
+        return;
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+        ctx.predict(P_STMT__OR_EXPR_SEMICOLON);
+        parse_or_expr(ctx);
+        ctx.match(T_SEMICOLON);
+        return;
+    default:
+        ctx.noRule(NT_STMT);
+    }
+}
+
+inline void parse_decl(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_FUNCTION:
+        ctx.predict(P_DECL__FUNCTION_DECL);
+        parse_function_decl(ctx);
+        return;
+    default:
+        ctx.noRule(NT_DECL);
+    }
+}
+
+inline void parse_let_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_LET:
+        ctx.predict(P_LET_EXPR__LET_BINDING_LIST_IN_OR_EXPR);
+        ctx.match(T_LET);
+        parse_binding_list(ctx);
+        ctx.match(T_IN);
+        parse_or_expr(ctx);
+        return;
+    default:
+        ctx.noRule(NT_LET_EXPR);
+    }
+}
+
+inline void parse_if_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_IF:
+        ctx.predict(P_IF_EXPR__IF_LPAREN_OR_EXPR_RPAREN_OR_EXPR_ELSE_PART);
+        ctx.match(T_IF);
+        ctx.match(T_LPAREN);
+        parse_or_expr(ctx);
+        ctx.match(T_RPAREN);
+        parse_or_expr(ctx);
+        parse_else_part(ctx);
+        return;
+    default:
+        ctx.noRule(NT_IF_EXPR);
+    }
+}
+
+inline void parse_while_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_WHILE:
+        ctx.predict(P_WHILE_EXPR__WHILE_LPAREN_OR_EXPR_RPAREN_OR_EXPR);
+        ctx.match(T_WHILE);
+        ctx.match(T_LPAREN);
+        parse_or_expr(ctx);
+        ctx.match(T_RPAREN);
+        parse_or_expr(ctx);
+        return;
+    default:
+        ctx.noRule(NT_WHILE_EXPR);
+    }
+}
+
+inline void parse_for_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_FOR:
+        ctx.predict(P_FOR_EXPR__FOR_LPAREN_IDENT_IN_OR_EXPR_RPAREN_OR_EXPR);
+        ctx.match(T_FOR);
+        ctx.match(T_LPAREN);
+        ctx.match(T_IDENT);
+        ctx.match(T_IN);
+        parse_or_expr(ctx);
+        ctx.match(T_RPAREN);
+        parse_or_expr(ctx);
+        return;
+    default:
+        ctx.noRule(NT_FOR_EXPR);
+    }
+}
+
+inline void parse_block_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_LBRACE:
+        ctx.predict(P_BLOCK_EXPR__LBRACE_STMT_LIST_RBRACE);
+        ctx.match(T_LBRACE);
+        parse_stmt_list(ctx);
+        ctx.match(T_RBRACE);
+        return;
+    default:
+        ctx.noRule(NT_BLOCK_EXPR);
+    }
+}
+
+inline void parse_or_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+        ctx.predict(P_OR_EXPR__AND_EXPR_OR_EXPR_PRIME);
+        parse_and_expr(ctx);
+        parse_or_expr_prime(ctx);
+        return;
+    default:
+        ctx.noRule(NT_OR_EXPR);
+    }
+}
+
+inline void parse_function_decl(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_FUNCTION:
+        ctx.predict(P_FUNCTION_DECL__FUNCTION_IDENT_LPAREN_PARAM_LIST_RPAREN_FUNCTION_BODY);
+        ctx.match(T_FUNCTION);
+        ctx.match(T_IDENT);
+        ctx.match(T_LPAREN);
+        parse_param_list(ctx);
+        ctx.match(T_RPAREN);
+        parse_function_body(ctx);
+        return;
+    default:
+        ctx.noRule(NT_FUNCTION_DECL);
+    }
+}
+
+inline void parse_and_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+        ctx.predict(P_AND_EXPR__EQ_EXPR_AND_EXPR_PRIME);
+        parse_eq_expr(ctx);
+        parse_and_expr_prime(ctx);
+        return;
+    default:
+        ctx.noRule(NT_AND_EXPR);
+    }
+}
+
+inline void parse_or_expr_prime(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_OR:
+            ctx.predict(P_OR_EXPR_PRIME__OR_AND_EXPR_OR_EXPR_PRIME);
+            ctx.match(T_OR);
+            parse_and_expr(ctx);
+            continue;
+        case T_SEMICOLON:
+        case T_RPAREN:
+        case T_IN:
+        case T_ELSE:
+        case T_ELIF:
+        case T_COMMA:
+            ctx.predict(P_OR_EXPR_PRIME__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_OR_EXPR_PRIME);
+        }
+    }
+}
+
+inline void parse_eq_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+        ctx.predict(P_EQ_EXPR__REL_EXPR_EQ_EXPR_PRIME);
+        parse_rel_expr(ctx);
+        parse_eq_expr_prime(ctx);
+        return;
+    default:
+        ctx.noRule(NT_EQ_EXPR);
+    }
+}
+
+inline void parse_and_expr_prime(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_AND:
+            ctx.predict(P_AND_EXPR_PRIME__AND_EQ_EXPR_AND_EXPR_PRIME);
+            ctx.match(T_AND);
+            parse_eq_expr(ctx);
+            continue;
+        case T_SEMICOLON:
+        case T_OR:
+        case T_RPAREN:
+        case T_IN:
+        case T_ELSE:
+        case T_ELIF:
+        case T_COMMA:
+            ctx.predict(P_AND_EXPR_PRIME__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_AND_EXPR_PRIME);
+        }
+    }
+}
+
+inline void parse_rel_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+        ctx.predict(P_REL_EXPR__ARITH_EXPR_REL_EXPR_PRIME);
+        parse_arith_expr(ctx);
+        parse_rel_expr_prime(ctx);
+        return;
+    default:
+        ctx.noRule(NT_REL_EXPR);
+    }
+}
+
+inline void parse_eq_expr_prime(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_EQ:
+            ctx.predict(P_EQ_EXPR_PRIME__EQ_REL_EXPR_EQ_EXPR_PRIME);
+            ctx.match(T_EQ);
+            parse_rel_expr(ctx);
+            continue;
+        case T_NEQ:
+            ctx.predict(P_EQ_EXPR_PRIME__NEQ_REL_EXPR_EQ_EXPR_PRIME);
+            ctx.match(T_NEQ);
+            parse_rel_expr(ctx);
+            continue;
+        case T_SEMICOLON:
+        case T_OR:
+        case T_AND:
+        case T_RPAREN:
+        case T_IN:
+        case T_ELSE:
+        case T_ELIF:
+        case T_COMMA:
+            ctx.predict(P_EQ_EXPR_PRIME__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_EQ_EXPR_PRIME);
+        }
+    }
+}
+
+inline void parse_arith_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+        ctx.predict(P_ARITH_EXPR__ADD_EXPR);
+        parse_add_expr(ctx);
+        return;
+    default:
+        ctx.noRule(NT_ARITH_EXPR);
+    }
+}
+
+inline void parse_rel_expr_prime(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_LESS_THAN:
+            ctx.predict(P_REL_EXPR_PRIME__LESS_THAN_ARITH_EXPR_REL_EXPR_PRIME);
+            ctx.match(T_LESS_THAN);
+            parse_arith_expr(ctx);
+            continue;
+        case T_GREATER_THAN:
+            ctx.predict(P_REL_EXPR_PRIME__GREATER_THAN_ARITH_EXPR_REL_EXPR_PRIME);
+            ctx.match(T_GREATER_THAN);
+            parse_arith_expr(ctx);
+            continue;
+        case T_LE:
+            ctx.predict(P_REL_EXPR_PRIME__LE_ARITH_EXPR_REL_EXPR_PRIME);
+            ctx.match(T_LE);
+            parse_arith_expr(ctx);
+            continue;
+        case T_GE:
+            ctx.predict(P_REL_EXPR_PRIME__GE_ARITH_EXPR_REL_EXPR_PRIME);
+            ctx.match(T_GE);
+            parse_arith_expr(ctx);
+            continue;
+        case T_SEMICOLON:
+        case T_OR:
+        case T_AND:
+        case T_EQ:
+        case T_NEQ:
+        case T_RPAREN:
+        case T_IN:
+        case T_ELSE:
+        case T_ELIF:
+        case T_COMMA:
+            ctx.predict(P_REL_EXPR_PRIME__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_REL_EXPR_PRIME);
+        }
+    }
+}
+
+inline void parse_add_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+        ctx.predict(P_ADD_EXPR__MULT_EXPR_ADD_EXPR_PRIME);
+        parse_mult_expr(ctx);
+        parse_add_expr_prime(ctx);
+        return;
+    default:
+        ctx.noRule(NT_ADD_EXPR);
+    }
+}
+
+inline void parse_mult_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+        ctx.predict(P_MULT_EXPR__PRIMARY_EXPR_MULT_EXPR_PRIME);
+        parse_primary_expr(ctx);
+        parse_mult_expr_prime(ctx);
+        return;
+    default:
+        ctx.noRule(NT_MULT_EXPR);
+    }
+}
+
+inline void parse_add_expr_prime(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_PLUS:
+            ctx.predict(P_ADD_EXPR_PRIME__PLUS_MULT_EXPR_ADD_EXPR_PRIME);
+            ctx.match(T_PLUS);
+            parse_mult_expr(ctx);
+            continue;
+        case T_MINUS:
+            ctx.predict(P_ADD_EXPR_PRIME__MINUS_MULT_EXPR_ADD_EXPR_PRIME);
+            ctx.match(T_MINUS);
+            parse_mult_expr(ctx);
+            continue;
+        case T_SEMICOLON:
+        case T_OR:
+        case T_AND:
+        case T_EQ:
+        case T_NEQ:
+        case T_LESS_THAN:
+        case T_GREATER_THAN:
+        case T_LE:
+        case T_GE:
+        case T_RPAREN:
+        case T_IN:
+        case T_ELSE:
+        case T_ELIF:
+        case T_COMMA:
+            ctx.predict(P_ADD_EXPR_PRIME__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_ADD_EXPR_PRIME);
+        }
+    }
+}
+
+inline void parse_primary_expr(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_NUMBER:
+        ctx.predict(P_PRIMARY_EXPR__NUMBER);
+        ctx.match(T_NUMBER);
+        return;
+    case T_STRING:
+        ctx.predict(P_PRIMARY_EXPR__STRING);
+        ctx.match(T_STRING);
+        return;
+    case T_TRUE:
+        ctx.predict(P_PRIMARY_EXPR__TRUE);
+        ctx.match(T_TRUE);
+        return;
+    case T_FALSE:
+        ctx.predict(P_PRIMARY_EXPR__FALSE);
+        ctx.match(T_FALSE);
+        return;
+    case T_IDENT:
+        ctx.predict(P_PRIMARY_EXPR__IDENT_IDENT_SUFFIX);
+        ctx.match(T_IDENT);
+        parse_ident_suffix(ctx);
+        return;
+    case T_LPAREN:
+        ctx.predict(P_PRIMARY_EXPR__LPAREN_OR_EXPR_RPAREN);
+        ctx.match(T_LPAREN);
+        parse_or_expr(ctx);
+        ctx.match(T_RPAREN);
+        return;
+    case T_NEW:
+        ctx.predict(P_PRIMARY_EXPR__NEW_IDENT_LPAREN_ARG_LIST_RPAREN);
+        ctx.match(T_NEW);
+        ctx.match(T_IDENT);
+        ctx.match(T_LPAREN);
+        parse_arg_list(ctx);
+        ctx.match(T_RPAREN);
+        return;
+    default:
+        ctx.noRule(NT_PRIMARY_EXPR);
+    }
+}
+
+inline void parse_mult_expr_prime(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_MULT:
+            ctx.predict(P_MULT_EXPR_PRIME__MULT_PRIMARY_EXPR_MULT_EXPR_PRIME);
+            ctx.match(T_MULT);
+            parse_primary_expr(ctx);
+            continue;
+        case T_DIV:
+            ctx.predict(P_MULT_EXPR_PRIME__DIV_PRIMARY_EXPR_MULT_EXPR_PRIME);
+            ctx.match(T_DIV);
+            parse_primary_expr(ctx);
+            continue;
+        case T_MOD:
+            ctx.predict(P_MULT_EXPR_PRIME__MOD_PRIMARY_EXPR_MULT_EXPR_PRIME);
+            ctx.match(T_MOD);
+            parse_primary_expr(ctx);
+            continue;
+        case T_SEMICOLON:
+        case T_OR:
+        case T_AND:
+        case T_EQ:
+        case T_NEQ:
+        case T_LESS_THAN:
+        case T_GREATER_THAN:
+        case T_LE:
+        case T_GE:
+        case T_PLUS:
+        case T_MINUS:
+        case T_RPAREN:
+        case T_IN:
+        case T_ELSE:
+        case T_ELIF:
+        case T_COMMA:
+            ctx.predict(P_MULT_EXPR_PRIME__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_MULT_EXPR_PRIME);
+        }
+    }
+}
+
+inline void parse_ident_suffix(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_LPAREN:
+        ctx.predict(P_IDENT_SUFFIX__LPAREN_ARG_LIST_RPAREN);
+        ctx.match(T_LPAREN);
+        parse_arg_list(ctx);
+        ctx.match(T_RPAREN);
+        return;
+    case T_SEMICOLON:
+    case T_OR:
+    case T_AND:
+    case T_EQ:
+    case T_NEQ:
+    case T_LESS_THAN:
+    case T_GREATER_THAN:
+    case T_LE:
+    case T_GE:
+    case T_PLUS:
+    case T_MINUS:
+    case T_MULT:
+    case T_DIV:
+    case T_MOD:
+    case T_RPAREN:
+    case T_IN:
+    case T_ELSE:
+    case T_ELIF:
+    case T_COMMA:
+        ctx.predict(P_IDENT_SUFFIX__EPSILON);
+        return;
+    default:
+        ctx.noRule(NT_IDENT_SUFFIX);
+    }
+}
+
+inline void parse_arg_list(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_NUMBER:
+    case T_STRING:
+    case T_TRUE:
+    case T_FALSE:
+    case T_IDENT:
+    case T_LPAREN:
+    case T_NEW:
+        ctx.predict(P_ARG_LIST__OR_EXPR_ARG_LIST_PRIME);
+        parse_or_expr(ctx);
+        parse_arg_list_prime(ctx);
+        return;
+    case T_RPAREN:
+        ctx.predict(P_ARG_LIST__EPSILON);
+        return;
+    default:
+        ctx.noRule(NT_ARG_LIST);
+    }
+}
+
+inline void parse_binding_list(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_IDENT:
+        ctx.predict(P_BINDING_LIST__BINDING_BINDING_LIST_PRIME);
+        parse_binding(ctx);
+        parse_binding_list_prime(ctx);
+        return;
+    default:
+        ctx.noRule(NT_BINDING_LIST);
+    }
+}
+
+inline void parse_else_part(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_ELSE:
+            ctx.predict(P_ELSE_PART__ELSE_OR_EXPR);
+            ctx.match(T_ELSE);
+            parse_or_expr(ctx);
+            return;
+        case T_ELIF:
+            ctx.predict(P_ELSE_PART__ELIF_LPAREN_OR_EXPR_RPAREN_OR_EXPR_ELSE_PART);
+            ctx.match(T_ELIF);
+            ctx.match(T_LPAREN);
+            parse_or_expr(ctx);
+            ctx.match(T_RPAREN);
+            parse_or_expr(ctx);
+            continue;
+        case T_SEMICOLON:
+            ctx.predict(P_ELSE_PART__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_ELSE_PART);
+        }
+    }
+}
+
+inline void parse_param_list(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_IDENT:
+        ctx.predict(P_PARAM_LIST__IDENT_PARAM_LIST_PRIME);
+        ctx.match(T_IDENT);
+        parse_param_list_prime(ctx);
+        return;
+    case T_RPAREN:
+        ctx.predict(P_PARAM_LIST__EPSILON);
+        return;
+    default:
+        ctx.noRule(NT_PARAM_LIST);
+    }
+}
+
+inline void parse_function_body(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_ARROW:
+        ctx.predict(P_FUNCTION_BODY__ARROW_OR_EXPR_SEMICOLON);
+        ctx.match(T_ARROW);
+        parse_or_expr(ctx);
+        ctx.match(T_SEMICOLON);
+        return;
+    case T_LBRACE:
+        ctx.predict(P_FUNCTION_BODY__BLOCK_EXPR);
+        parse_block_expr(ctx);
+        return;
+    default:
+        ctx.noRule(NT_FUNCTION_BODY);
+    }
+}
+
+inline void parse_param_list_prime(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_COMMA:
+            ctx.predict(P_PARAM_LIST_PRIME__COMMA_IDENT_PARAM_LIST_PRIME);
+            ctx.match(T_COMMA);
+            ctx.match(T_IDENT);
+            continue;
+        case T_RPAREN:
+            ctx.predict(P_PARAM_LIST_PRIME__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_PARAM_LIST_PRIME);
+        }
+    }
+}
+
+inline void parse_arg_list_prime(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_COMMA:
+            ctx.predict(P_ARG_LIST_PRIME__COMMA_OR_EXPR_ARG_LIST_PRIME);
+            ctx.match(T_COMMA);
+            parse_or_expr(ctx);
+            continue;
+        case T_RPAREN:
+            ctx.predict(P_ARG_LIST_PRIME__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_ARG_LIST_PRIME);
+        }
+    }
+}
+
+inline void parse_binding(ParseContext& ctx) {
+    switch (ctx.lookahead()) {
+    case T_IDENT:
+        ctx.predict(P_BINDING__IDENT_ASSIGN_DESTRUCT_OR_EXPR);
+        ctx.match(T_IDENT);
+        ctx.match(T_ASSIGN_DESTRUCT);
+        parse_or_expr(ctx);
+        return;
+    default:
+        ctx.noRule(NT_BINDING);
+    }
+}
+
+inline void parse_binding_list_prime(ParseContext& ctx) {
+    for (;;) {
+        switch (ctx.lookahead()) {
+        case T_COMMA:
+            ctx.predict(P_BINDING_LIST_PRIME__COMMA_BINDING_BINDING_LIST_PRIME);
+            ctx.match(T_COMMA);
+            parse_binding(ctx);
+            continue;
+        case T_IN:
+            ctx.predict(P_BINDING_LIST_PRIME__EPSILON);
+            return;
+        default:
+            ctx.noRule(NT_BINDING_LIST_PRIME);
+        }
+    }
+}
+
+} // namespace RecursiveDescent
+
+// Punto de entrada para LL1Parser::setGeneratedParser(parse, GRAMMAR_HASH, parseFrom)
+inline void parse(ParseContext& ctx) {
+    RecursiveDescent::parse_program(ctx);
+}
+
+// Análisis a partir de cualquier no terminal (LL1Parser::setStatementThreads)
+inline void parseFrom(ParseContext& ctx, SymbolId nonTerminal) {
+    switch (nonTerminal) {
+    case NT_PROGRAM:
+        RecursiveDescent::parse_program(ctx);
+        return;
+    case NT_STMT_LIST:
+        RecursiveDescent::parse_stmt_list(ctx);
+        return;
+    case NT_STMT:
+        RecursiveDescent::parse_stmt(ctx);
+        return;
+    case NT_DECL:
+        RecursiveDescent::parse_decl(ctx);
+        return;
+    case NT_LET_EXPR:
+        RecursiveDescent::parse_let_expr(ctx);
+        return;
+    case NT_IF_EXPR:
+        RecursiveDescent::parse_if_expr(ctx);
+        return;
+    case NT_WHILE_EXPR:
+        RecursiveDescent::parse_while_expr(ctx);
+        return;
+    case NT_FOR_EXPR:
+        RecursiveDescent::parse_for_expr(ctx);
+        return;
+    case NT_BLOCK_EXPR:
+        RecursiveDescent::parse_block_expr(ctx);
+        return;
+    case NT_OR_EXPR:
+        RecursiveDescent::parse_or_expr(ctx);
+        return;
+    case NT_FUNCTION_DECL:
+        RecursiveDescent::parse_function_decl(ctx);
+        return;
+    case NT_AND_EXPR:
+        RecursiveDescent::parse_and_expr(ctx);
+        return;
+    case NT_OR_EXPR_PRIME:
+        RecursiveDescent::parse_or_expr_prime(ctx);
+        return;
+    case NT_EQ_EXPR:
+        RecursiveDescent::parse_eq_expr(ctx);
+        return;
+    case NT_AND_EXPR_PRIME:
+        RecursiveDescent::parse_and_expr_prime(ctx);
+        return;
+    case NT_REL_EXPR:
+        RecursiveDescent::parse_rel_expr(ctx);
+        return;
+    case NT_EQ_EXPR_PRIME:
+        RecursiveDescent::parse_eq_expr_prime(ctx);
+        return;
+    case NT_ARITH_EXPR:
+        RecursiveDescent::parse_arith_expr(ctx);
+        return;
+    case NT_REL_EXPR_PRIME:
+        RecursiveDescent::parse_rel_expr_prime(ctx);
+        return;
+    case NT_ADD_EXPR:
+        RecursiveDescent::parse_add_expr(ctx);
+        return;
+    case NT_MULT_EXPR:
+        RecursiveDescent::parse_mult_expr(ctx);
+        return;
+    case NT_ADD_EXPR_PRIME:
+        RecursiveDescent::parse_add_expr_prime(ctx);
+        return;
+    case NT_PRIMARY_EXPR:
+        RecursiveDescent::parse_primary_expr(ctx);
+        return;
+    case NT_MULT_EXPR_PRIME:
+        RecursiveDescent::parse_mult_expr_prime(ctx);
+        return;
+    case NT_IDENT_SUFFIX:
+        RecursiveDescent::parse_ident_suffix(ctx);
+        return;
+    case NT_ARG_LIST:
+        RecursiveDescent::parse_arg_list(ctx);
+        return;
+    case NT_BINDING_LIST:
+        RecursiveDescent::parse_binding_list(ctx);
+        return;
+    case NT_ELSE_PART:
+        RecursiveDescent::parse_else_part(ctx);
+        return;
+    case NT_PARAM_LIST:
+        RecursiveDescent::parse_param_list(ctx);
+        return;
+    case NT_FUNCTION_BODY:
+        RecursiveDescent::parse_function_body(ctx);
+        return;
+    case NT_PARAM_LIST_PRIME:
+        RecursiveDescent::parse_param_list_prime(ctx);
+        return;
+    case NT_ARG_LIST_PRIME:
+        RecursiveDescent::parse_arg_list_prime(ctx);
+        return;
+    case NT_BINDING:
+        RecursiveDescent::parse_binding(ctx);
+        return;
+    case NT_BINDING_LIST_PRIME:
+        RecursiveDescent::parse_binding_list_prime(ctx);
+        return;
+    default:
+        throw std::out_of_range("No generated function for non-terminal " + std::to_string(nonTerminal));
+    }
+}
+
+} // namespace HulkV3
+} // namespace LL1
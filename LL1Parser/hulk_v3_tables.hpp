@@ -0,0 +1,647 @@
+// Generado por generate_tables a partir de ParserFactory::createFullHulkGrammarV3().
+// No editar a mano: regenerar con 'make generate-tables'.
+#pragma once
+
+#include "ll1_compiled_grammar.hpp"
+
+namespace LL1 {
+namespace HulkV3 {
+
+inline constexpr std::uint64_t GRAMMAR_HASH = 0x9cde46d53e74bbfaULL;
+inline constexpr bool IS_LL1 = true;
+
+enum Terminal : SymbolId {
+    T_END_OF_INPUT = 0,
+    T_SEMICOLON = 1,
+    T_OR = 2,
+    T_AND = 3,
+    T_EQ = 4,
+    T_NEQ = 5,
+    T_LESS_THAN = 6,
+    T_GREATER_THAN = 7,
+    T_LE = 8,
+    T_GE = 9,
+    T_PLUS = 10,
+    T_MINUS = 11,
+    T_MULT = 12,
+    T_DIV = 13,
+    T_MOD = 14,
+    T_NUMBER = 15,
+    T_STRING = 16,
+    T_TRUE = 17,
+    T_FALSE = 18,
+    T_IDENT = 19,
+    T_LPAREN = 20,
+    T_RPAREN = 21,
+    T_NEW = 22,
+    T_LET = 23,
+    T_IN = 24,
+    T_IF = 25,
+    T_ELSE = 26,
+    T_ELIF = 27,
+    T_WHILE = 28,
+    T_FOR = 29,
+    T_LBRACE = 30,
+    T_RBRACE = 31,
+    T_FUNCTION = 32,
+    T_ARROW = 33,
+    T_COMMA = 34,
+    T_ASSIGN_DESTRUCT = 35,
+    TERMINAL_COUNT = 36
+};
+
+enum NonTerminal : SymbolId {
+    NT_PROGRAM = 0,
+    NT_STMT_LIST = 1,
+    NT_STMT = 2,
+    NT_DECL = 3,
+    NT_LET_EXPR = 4,
+    NT_IF_EXPR = 5,
+    NT_WHILE_EXPR = 6,
+    NT_FOR_EXPR = 7,
+    NT_BLOCK_EXPR = 8,
+    NT_OR_EXPR = 9,
+    NT_FUNCTION_DECL = 10,
+    NT_AND_EXPR = 11,
+    NT_OR_EXPR_PRIME = 12,
+    NT_EQ_EXPR = 13,
+    NT_AND_EXPR_PRIME = 14,
+    NT_REL_EXPR = 15,
+    NT_EQ_EXPR_PRIME = 16,
+    NT_ARITH_EXPR = 17,
+    NT_REL_EXPR_PRIME = 18,
+    NT_ADD_EXPR = 19,
+    NT_MULT_EXPR = 20,
+    NT_ADD_EXPR_PRIME = 21,
+    NT_PRIMARY_EXPR = 22,
+    NT_MULT_EXPR_PRIME = 23,
+    NT_IDENT_SUFFIX = 24,
+    NT_ARG_LIST = 25,
+    NT_BINDING_LIST = 26,
+    NT_ELSE_PART = 27,
+    NT_PARAM_LIST = 28,
+    NT_FUNCTION_BODY = 29,
+    NT_PARAM_LIST_PRIME = 30,
+    NT_ARG_LIST_PRIME = 31,
+    NT_BINDING = 32,
+    NT_BINDING_LIST_PRIME = 33,
+    NON_TERMINAL_COUNT = 34
+};
+
+enum Production : std::uint16_t {
+    P_PROGRAM__STMT_LIST = 0,                                                     // program -> stmt_list
+    P_STMT_LIST__STMT_STMT_LIST = 1,                                              // stmt_list -> stmt stmt_list
+    P_STMT_LIST__EPSILON = 2,                                                     // stmt_list -> ε
+    P_STMT__DECL = 3,                                                             // stmt -> decl
+    P_STMT__LET_EXPR_SEMICOLON = 4,                                               // stmt -> let_expr SEMICOLON
+    P_STMT__IF_EXPR_SEMICOLON = 5,                                                // stmt -> if_expr SEMICOLON
+    P_STMT__WHILE_EXPR_SEMICOLON = 6,                                             // stmt -> while_expr SEMICOLON
+    P_STMT__FOR_EXPR_SEMICOLON = 7,                                               // stmt -> for_expr SEMICOLON
+    P_STMT__BLOCK_EXPR_SEMICOLON = 8,                                             // stmt -> block_expr SEMICOLON
+    P_STMT__OR_EXPR_SEMICOLON = 9,                                                // stmt -> or_expr SEMICOLON
+    P_DECL__FUNCTION_DECL = 10,                                                   // decl -> function_decl
+    P_OR_EXPR__AND_EXPR_OR_EXPR_PRIME = 11,                                       // or_expr -> and_expr or_expr_prime
+    P_OR_EXPR_PRIME__OR_AND_EXPR_OR_EXPR_PRIME = 12,                              // or_expr_prime -> OR and_expr or_expr_prime
+    P_OR_EXPR_PRIME__EPSILON = 13,                                                // or_expr_prime -> ε
+    P_AND_EXPR__EQ_EXPR_AND_EXPR_PRIME = 14,                                      // and_expr -> eq_expr and_expr_prime
+    P_AND_EXPR_PRIME__AND_EQ_EXPR_AND_EXPR_PRIME = 15,                            // and_expr_prime -> AND eq_expr and_expr_prime
+    P_AND_EXPR_PRIME__EPSILON = 16,                                               // and_expr_prime -> ε
+    P_EQ_EXPR__REL_EXPR_EQ_EXPR_PRIME = 17,                                       // eq_expr -> rel_expr eq_expr_prime
+    P_EQ_EXPR_PRIME__EQ_REL_EXPR_EQ_EXPR_PRIME = 18,                              // eq_expr_prime -> EQ rel_expr eq_expr_prime
+    P_EQ_EXPR_PRIME__NEQ_REL_EXPR_EQ_EXPR_PRIME = 19,                             // eq_expr_prime -> NEQ rel_expr eq_expr_prime
+    P_EQ_EXPR_PRIME__EPSILON = 20,                                                // eq_expr_prime -> ε
+    P_REL_EXPR__ARITH_EXPR_REL_EXPR_PRIME = 21,                                   // rel_expr -> arith_expr rel_expr_prime
+    P_REL_EXPR_PRIME__LESS_THAN_ARITH_EXPR_REL_EXPR_PRIME = 22,                   // rel_expr_prime -> LESS_THAN arith_expr rel_expr_prime
+    P_REL_EXPR_PRIME__GREATER_THAN_ARITH_EXPR_REL_EXPR_PRIME = 23,                // rel_expr_prime -> GREATER_THAN arith_expr rel_expr_prime
+    P_REL_EXPR_PRIME__LE_ARITH_EXPR_REL_EXPR_PRIME = 24,                          // rel_expr_prime -> LE arith_expr rel_expr_prime
+    P_REL_EXPR_PRIME__GE_ARITH_EXPR_REL_EXPR_PRIME = 25,                          // rel_expr_prime -> GE arith_expr rel_expr_prime
+    P_REL_EXPR_PRIME__EPSILON = 26,                                               // rel_expr_prime -> ε
+    P_ARITH_EXPR__ADD_EXPR = 27,                                                  // arith_expr -> add_expr
+    P_ADD_EXPR__MULT_EXPR_ADD_EXPR_PRIME = 28,                                    // add_expr -> mult_expr add_expr_prime
+    P_ADD_EXPR_PRIME__PLUS_MULT_EXPR_ADD_EXPR_PRIME = 29,                         // add_expr_prime -> PLUS mult_expr add_expr_prime
+    P_ADD_EXPR_PRIME__MINUS_MULT_EXPR_ADD_EXPR_PRIME = 30,                        // add_expr_prime -> MINUS mult_expr add_expr_prime
+    P_ADD_EXPR_PRIME__EPSILON = 31,                                               // add_expr_prime -> ε
+    P_MULT_EXPR__PRIMARY_EXPR_MULT_EXPR_PRIME = 32,                               // mult_expr -> primary_expr mult_expr_prime
+    P_MULT_EXPR_PRIME__MULT_PRIMARY_EXPR_MULT_EXPR_PRIME = 33,                    // mult_expr_prime -> MULT primary_expr mult_expr_prime
+    P_MULT_EXPR_PRIME__DIV_PRIMARY_EXPR_MULT_EXPR_PRIME = 34,                     // mult_expr_prime -> DIV primary_expr mult_expr_prime
+    P_MULT_EXPR_PRIME__MOD_PRIMARY_EXPR_MULT_EXPR_PRIME = 35,                     // mult_expr_prime -> MOD primary_expr mult_expr_prime
+    P_MULT_EXPR_PRIME__EPSILON = 36,                                              // mult_expr_prime -> ε
+    P_PRIMARY_EXPR__NUMBER = 37,                                                  // primary_expr -> NUMBER
+    P_PRIMARY_EXPR__STRING = 38,                                                  // primary_expr -> STRING
+    P_PRIMARY_EXPR__TRUE = 39,                                                    // primary_expr -> TRUE
+    P_PRIMARY_EXPR__FALSE = 40,                                                   // primary_expr -> FALSE
+    P_PRIMARY_EXPR__IDENT_IDENT_SUFFIX = 41,                                      // primary_expr -> IDENT ident_suffix
+    P_PRIMARY_EXPR__LPAREN_OR_EXPR_RPAREN = 42,                                   // primary_expr -> LPAREN or_expr RPAREN
+    P_PRIMARY_EXPR__NEW_IDENT_LPAREN_ARG_LIST_RPAREN = 43,                        // primary_expr -> NEW IDENT LPAREN arg_list RPAREN
+    P_IDENT_SUFFIX__LPAREN_ARG_LIST_RPAREN = 44,                                  // ident_suffix -> LPAREN arg_list RPAREN
+    P_IDENT_SUFFIX__EPSILON = 45,                                                 // ident_suffix -> ε
+    P_LET_EXPR__LET_BINDING_LIST_IN_OR_EXPR = 46,                                 // let_expr -> LET binding_list IN or_expr
+    P_IF_EXPR__IF_LPAREN_OR_EXPR_RPAREN_OR_EXPR_ELSE_PART = 47,                   // if_expr -> IF LPAREN or_expr RPAREN or_expr else_part
+    P_ELSE_PART__ELSE_OR_EXPR = 48,                                               // else_part -> ELSE or_expr
+    P_ELSE_PART__ELIF_LPAREN_OR_EXPR_RPAREN_OR_EXPR_ELSE_PART = 49,               // else_part -> ELIF LPAREN or_expr RPAREN or_expr else_part
+    P_ELSE_PART__EPSILON = 50,                                                    // else_part -> ε
+    P_WHILE_EXPR__WHILE_LPAREN_OR_EXPR_RPAREN_OR_EXPR = 51,                       // while_expr -> WHILE LPAREN or_expr RPAREN or_expr
+    P_FOR_EXPR__FOR_LPAREN_IDENT_IN_OR_EXPR_RPAREN_OR_EXPR = 52,                  // for_expr -> FOR LPAREN IDENT IN or_expr RPAREN or_expr
+    P_BLOCK_EXPR__LBRACE_STMT_LIST_RBRACE = 53,                                   // block_expr -> LBRACE stmt_list RBRACE
+    P_FUNCTION_DECL__FUNCTION_IDENT_LPAREN_PARAM_LIST_RPAREN_FUNCTION_BODY = 54,  // function_decl -> FUNCTION IDENT LPAREN param_list RPAREN function_body
+    P_FUNCTION_BODY__ARROW_OR_EXPR_SEMICOLON = 55,                                // function_body -> ARROW or_expr SEMICOLON
+    P_FUNCTION_BODY__BLOCK_EXPR = 56,                                             // function_body -> block_expr
+    P_PARAM_LIST__IDENT_PARAM_LIST_PRIME = 57,                                    // param_list -> IDENT param_list_prime
+    P_PARAM_LIST__EPSILON = 58,                                                   // param_list -> ε
+    P_PARAM_LIST_PRIME__COMMA_IDENT_PARAM_LIST_PRIME = 59,                        // param_list_prime -> COMMA IDENT param_list_prime
+    P_PARAM_LIST_PRIME__EPSILON = 60,                                             // param_list_prime -> ε
+    P_ARG_LIST__OR_EXPR_ARG_LIST_PRIME = 61,                                      // arg_list -> or_expr arg_list_prime
+    P_ARG_LIST__EPSILON = 62,                                                     // arg_list -> ε
+    P_ARG_LIST_PRIME__COMMA_OR_EXPR_ARG_LIST_PRIME = 63,                          // arg_list_prime -> COMMA or_expr arg_list_prime
+    P_ARG_LIST_PRIME__EPSILON = 64,                                               // arg_list_prime -> ε
+    P_BINDING_LIST__BINDING_BINDING_LIST_PRIME = 65,                              // binding_list -> binding binding_list_prime
+    P_BINDING_LIST_PRIME__COMMA_BINDING_BINDING_LIST_PRIME = 66,                  // binding_list_prime -> COMMA binding binding_list_prime
+    P_BINDING_LIST_PRIME__EPSILON = 67,                                           // binding_list_prime -> ε
+    P_BINDING__IDENT_ASSIGN_DESTRUCT_OR_EXPR = 68,                                // binding -> IDENT ASSIGN_DESTRUCT or_expr
+    PRODUCTION_COUNT = 69
+};
+
+inline constexpr SymbolId START_CODE = NON_TERMINAL_FLAG | NT_PROGRAM;
+inline constexpr std::uint16_t NO_PRODUCTION = DenseParseTable::NO_PRODUCTION;
+
+inline constexpr char SYMBOL_NAMES[] =
+    "SEMICOLON\000"
+    "OR\000"
+    "AND\000"
+    "EQ\000"
+    "NEQ\000"
+    "LESS_THAN\000"
+    "GREATER_THAN\000"
+    "LE\000"
+    "GE\000"
+    "PLUS\000"
+    "MINUS\000"
+    "MULT\000"
+    "DIV\000"
+    "MOD\000"
+    "NUMBER\000"
+    "STRING\000"
+    "TRUE\000"
+    "FALSE\000"
+    "IDENT\000"
+    "LPAREN\000"
+    "RPAREN\000"
+    "NEW\000"
+    "LET\000"
+    "IN\000"
+    "IF\000"
+    "ELSE\000"
+    "ELIF\000"
+    "WHILE\000"
+    "FOR\000"
+    "LBRACE\000"
+    "RBRACE\000"
+    "FUNCTION\000"
+    "ARROW\000"
+    "COMMA\000"
+    "ASSIGN_DESTRUCT\000"
+    "program\000"
+    "stmt_list\000"
+    "stmt\000"
+    "decl\000"
+    "let_expr\000"
+    "if_expr\000"
+    "while_expr\000"
+    "for_expr\000"
+    "block_expr\000"
+    "or_expr\000"
+    "function_decl\000"
+    "and_expr\000"
+    "or_expr_prime\000"
+    "eq_expr\000"
+    "and_expr_prime\000"
+    "rel_expr\000"
+    "eq_expr_prime\000"
+    "arith_expr\000"
+    "rel_expr_prime\000"
+    "add_expr\000"
+    "mult_expr\000"
+    "add_expr_prime\000"
+    "primary_expr\000"
+    "mult_expr_prime\000"
+    "ident_suffix\000"
+    "arg_list\000"
+    "binding_list\000"
+    "else_part\000"
+    "param_list\000"
+    "function_body\000"
+    "param_list_prime\000"
+    "arg_list_prime\000"
+    "binding\000"
+    "binding_list_prime\000";
+
+inline constexpr std::uint32_t NAME_OFFSETS[TERMINAL_COUNT - 1 + NON_TERMINAL_COUNT] = {
+    0, 10, 13, 17, 20, 24, 34, 47, 50, 53, 58, 64, 69, 73, 77, 84,
+    91, 96, 102, 108, 115, 122, 126, 130, 133, 136, 141, 146, 152, 156, 163, 170,
+    179, 185, 191, 207, 215, 225, 230, 235, 244, 252, 263, 272, 283, 291, 305, 314,
+    328, 336, 351, 360, 374, 385, 400, 409, 419, 434, 447, 463, 476, 485, 498, 508,
+    519, 533, 550, 565, 573,
+};
+
+// Tabla de predicción densa: PARSE_TABLE[no terminal][terminal]
+inline constexpr std::uint16_t PARSE_TABLE[NON_TERMINAL_COUNT][TERMINAL_COUNT] = {
+    /* program */ {0, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 0, 0, 0, 0, 0, 0, NO_PRODUCTION, 0, 0, NO_PRODUCTION, 0, NO_PRODUCTION, NO_PRODUCTION, 0, 0, 0, NO_PRODUCTION, 0, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* stmt_list */ {2, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 1, 1, 1, 1, 1, 1, NO_PRODUCTION, 1, 1, NO_PRODUCTION, 1, NO_PRODUCTION, NO_PRODUCTION, 1, 1, 1, 2, 1, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* stmt */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 9, 9, 9, 9, 9, 9, NO_PRODUCTION, 9, 4, NO_PRODUCTION, 5, NO_PRODUCTION, NO_PRODUCTION, 6, 7, 8, NO_PRODUCTION, 3, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* decl */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 10, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* let_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 46, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* if_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 47, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* while_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 51, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* for_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 52, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* block_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 53, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* or_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 11, 11, 11, 11, 11, 11, NO_PRODUCTION, 11, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* function_decl */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 54, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* and_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 14, 14, 14, 14, 14, 14, NO_PRODUCTION, 14, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* or_expr_prime */ {NO_PRODUCTION, 13, 12, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 13, NO_PRODUCTION, NO_PRODUCTION, 13, NO_PRODUCTION, 13, 13, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 13, NO_PRODUCTION},
+    /* eq_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 17, 17, 17, 17, 17, 17, NO_PRODUCTION, 17, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* and_expr_prime */ {NO_PRODUCTION, 16, 16, 15, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 16, NO_PRODUCTION, NO_PRODUCTION, 16, NO_PRODUCTION, 16, 16, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 16, NO_PRODUCTION},
+    /* rel_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 21, 21, 21, 21, 21, 21, NO_PRODUCTION, 21, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* eq_expr_prime */ {NO_PRODUCTION, 20, 20, 20, 18, 19, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 20, NO_PRODUCTION, NO_PRODUCTION, 20, NO_PRODUCTION, 20, 20, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 20, NO_PRODUCTION},
+    /* arith_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 27, 27, 27, 27, 27, 27, NO_PRODUCTION, 27, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* rel_expr_prime */ {NO_PRODUCTION, 26, 26, 26, 26, 26, 22, 23, 24, 25, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 26, NO_PRODUCTION, NO_PRODUCTION, 26, NO_PRODUCTION, 26, 26, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 26, NO_PRODUCTION},
+    /* add_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 28, 28, 28, 28, 28, 28, NO_PRODUCTION, 28, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* mult_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 32, 32, 32, 32, 32, 32, NO_PRODUCTION, 32, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* add_expr_prime */ {NO_PRODUCTION, 31, 31, 31, 31, 31, 31, 31, 31, 31, 29, 30, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 31, NO_PRODUCTION, NO_PRODUCTION, 31, NO_PRODUCTION, 31, 31, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 31, NO_PRODUCTION},
+    /* primary_expr */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 37, 38, 39, 40, 41, 42, NO_PRODUCTION, 43, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* mult_expr_prime */ {NO_PRODUCTION, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 33, 34, 35, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 36, NO_PRODUCTION, NO_PRODUCTION, 36, NO_PRODUCTION, 36, 36, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 36, NO_PRODUCTION},
+    /* ident_suffix */ {NO_PRODUCTION, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 44, 45, NO_PRODUCTION, NO_PRODUCTION, 45, NO_PRODUCTION, 45, 45, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 45, NO_PRODUCTION},
+    /* arg_list */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 61, 61, 61, 61, 61, 61, 62, 61, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* binding_list */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 65, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* else_part */ {NO_PRODUCTION, 50, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 48, 49, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* param_list */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 57, NO_PRODUCTION, 58, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* function_body */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 56, NO_PRODUCTION, NO_PRODUCTION, 55, NO_PRODUCTION, NO_PRODUCTION},
+    /* param_list_prime */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 60, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 59, NO_PRODUCTION},
+    /* arg_list_prime */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 64, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 63, NO_PRODUCTION},
+    /* binding */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 68, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION},
+    /* binding_list_prime */ {NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 67, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, NO_PRODUCTION, 66, NO_PRODUCTION},
+};
+
+constexpr int predict(NonTerminal nonTerminal, Terminal terminal) {
+    return PARSE_TABLE[nonTerminal][terminal] == NO_PRODUCTION ? -1 : PARSE_TABLE[nonTerminal][terminal];
+}
+
+// Producciones aplanadas: lado izquierdo y códigos del lado derecho (sin ε),
+// el de p en RHS_CODES[RHS_START[p] .. RHS_START[p + 1])
+inline constexpr SymbolId PRODUCTION_LHS[PRODUCTION_COUNT] = {
+    NT_PROGRAM,
+    NT_STMT_LIST,
+    NT_STMT_LIST,
+    NT_STMT,
+    NT_STMT,
+    NT_STMT,
+    NT_STMT,
+    NT_STMT,
+    NT_STMT,
+    NT_STMT,
+    NT_DECL,
+    NT_OR_EXPR,
+    NT_OR_EXPR_PRIME,
+    NT_OR_EXPR_PRIME,
+    NT_AND_EXPR,
+    NT_AND_EXPR_PRIME,
+    NT_AND_EXPR_PRIME,
+    NT_EQ_EXPR,
+    NT_EQ_EXPR_PRIME,
+    NT_EQ_EXPR_PRIME,
+    NT_EQ_EXPR_PRIME,
+    NT_REL_EXPR,
+    NT_REL_EXPR_PRIME,
+    NT_REL_EXPR_PRIME,
+    NT_REL_EXPR_PRIME,
+    NT_REL_EXPR_PRIME,
+    NT_REL_EXPR_PRIME,
+    NT_ARITH_EXPR,
+    NT_ADD_EXPR,
+    NT_ADD_EXPR_PRIME,
+    NT_ADD_EXPR_PRIME,
+    NT_ADD_EXPR_PRIME,
+    NT_MULT_EXPR,
+    NT_MULT_EXPR_PRIME,
+    NT_MULT_EXPR_PRIME,
+    NT_MULT_EXPR_PRIME,
+    NT_MULT_EXPR_PRIME,
+    NT_PRIMARY_EXPR,
+    NT_PRIMARY_EXPR,
+    NT_PRIMARY_EXPR,
+    NT_PRIMARY_EXPR,
+    NT_PRIMARY_EXPR,
+    NT_PRIMARY_EXPR,
+    NT_PRIMARY_EXPR,
+    NT_IDENT_SUFFIX,
+    NT_IDENT_SUFFIX,
+    NT_LET_EXPR,
+    NT_IF_EXPR,
+    NT_ELSE_PART,
+    NT_ELSE_PART,
+    NT_ELSE_PART,
+    NT_WHILE_EXPR,
+    NT_FOR_EXPR,
+    NT_BLOCK_EXPR,
+    NT_FUNCTION_DECL,
+    NT_FUNCTION_BODY,
+    NT_FUNCTION_BODY,
+    NT_PARAM_LIST,
+    NT_PARAM_LIST,
+    NT_PARAM_LIST_PRIME,
+    NT_PARAM_LIST_PRIME,
+    NT_ARG_LIST,
+    NT_ARG_LIST,
+    NT_ARG_LIST_PRIME,
+    NT_ARG_LIST_PRIME,
+    NT_BINDING_LIST,
+    NT_BINDING_LIST_PRIME,
+    NT_BINDING_LIST_PRIME,
+    NT_BINDING,
+};
+
+inline constexpr std::uint32_t RHS_START[PRODUCTION_COUNT + 1] = {
+    0,
+    1,
+    3,
+    3,
+    4,
+    6,
+    8,
+    10,
+    12,
+    14,
+    16,
+    17,
+    19,
+    22,
+    22,
+    24,
+    27,
+    27,
+    29,
+    32,
+    35,
+    35,
+    37,
+    40,
+    43,
+    46,
+    49,
+    49,
+    50,
+    52,
+    55,
+    58,
+    58,
+    60,
+    63,
+    66,
+    69,
+    69,
+    70,
+    71,
+    72,
+    73,
+    75,
+    78,
+    83,
+    86,
+    86,
+    90,
+    96,
+    98,
+    104,
+    104,
+    109,
+    116,
+    119,
+    125,
+    128,
+    129,
+    131,
+    131,
+    134,
+    134,
+    136,
+    136,
+    139,
+    139,
+    141,
+    144,
+    144,
+    147
+};
+
+inline constexpr std::uint32_t RHS_CODE_COUNT = 147;
+inline constexpr SymbolId RHS_CODES[] = {
+    /* P_PROGRAM__STMT_LIST */ NON_TERMINAL_FLAG | NT_STMT_LIST,
+    /* P_STMT_LIST__STMT_STMT_LIST */ NON_TERMINAL_FLAG | NT_STMT, NON_TERMINAL_FLAG | NT_STMT_LIST,
+    /* P_STMT__DECL */ NON_TERMINAL_FLAG | NT_DECL,
+    /* P_STMT__LET_EXPR_SEMICOLON */ NON_TERMINAL_FLAG | NT_LET_EXPR, T_SEMICOLON,
+    /* P_STMT__IF_EXPR_SEMICOLON */ NON_TERMINAL_FLAG | NT_IF_EXPR, T_SEMICOLON,
+    /* P_STMT__WHILE_EXPR_SEMICOLON */ NON_TERMINAL_FLAG | NT_WHILE_EXPR, T_SEMICOLON,
+    /* P_STMT__FOR_EXPR_SEMICOLON */ NON_TERMINAL_FLAG | NT_FOR_EXPR, T_SEMICOLON,
+    /* P_STMT__BLOCK_EXPR_SEMICOLON */ NON_TERMINAL_FLAG | NT_BLOCK_EXPR, T_SEMICOLON,
+    /* P_STMT__OR_EXPR_SEMICOLON */ NON_TERMINAL_FLAG | NT_OR_EXPR, T_SEMICOLON,
+    /* P_DECL__FUNCTION_DECL */ NON_TERMINAL_FLAG | NT_FUNCTION_DECL,
+    /* P_OR_EXPR__AND_EXPR_OR_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_AND_EXPR, NON_TERMINAL_FLAG | NT_OR_EXPR_PRIME,
+    /* P_OR_EXPR_PRIME__OR_AND_EXPR_OR_EXPR_PRIME */ T_OR, NON_TERMINAL_FLAG | NT_AND_EXPR, NON_TERMINAL_FLAG | NT_OR_EXPR_PRIME,
+    /* P_AND_EXPR__EQ_EXPR_AND_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_EQ_EXPR, NON_TERMINAL_FLAG | NT_AND_EXPR_PRIME,
+    /* P_AND_EXPR_PRIME__AND_EQ_EXPR_AND_EXPR_PRIME */ T_AND, NON_TERMINAL_FLAG | NT_EQ_EXPR, NON_TERMINAL_FLAG | NT_AND_EXPR_PRIME,
+    /* P_EQ_EXPR__REL_EXPR_EQ_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_REL_EXPR, NON_TERMINAL_FLAG | NT_EQ_EXPR_PRIME,
+    /* P_EQ_EXPR_PRIME__EQ_REL_EXPR_EQ_EXPR_PRIME */ T_EQ, NON_TERMINAL_FLAG | NT_REL_EXPR, NON_TERMINAL_FLAG | NT_EQ_EXPR_PRIME,
+    /* P_EQ_EXPR_PRIME__NEQ_REL_EXPR_EQ_EXPR_PRIME */ T_NEQ, NON_TERMINAL_FLAG | NT_REL_EXPR, NON_TERMINAL_FLAG | NT_EQ_EXPR_PRIME,
+    /* P_REL_EXPR__ARITH_EXPR_REL_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_ARITH_EXPR, NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME,
+    /* P_REL_EXPR_PRIME__LESS_THAN_ARITH_EXPR_REL_EXPR_PRIME */ T_LESS_THAN, NON_TERMINAL_FLAG | NT_ARITH_EXPR, NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME,
+    /* P_REL_EXPR_PRIME__GREATER_THAN_ARITH_EXPR_REL_EXPR_PRIME */ T_GREATER_THAN, NON_TERMINAL_FLAG | NT_ARITH_EXPR, NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME,
+    /* P_REL_EXPR_PRIME__LE_ARITH_EXPR_REL_EXPR_PRIME */ T_LE, NON_TERMINAL_FLAG | NT_ARITH_EXPR, NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME,
+    /* P_REL_EXPR_PRIME__GE_ARITH_EXPR_REL_EXPR_PRIME */ T_GE, NON_TERMINAL_FLAG | NT_ARITH_EXPR, NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME,
+    /* P_ARITH_EXPR__ADD_EXPR */ NON_TERMINAL_FLAG | NT_ADD_EXPR,
+    /* P_ADD_EXPR__MULT_EXPR_ADD_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_MULT_EXPR, NON_TERMINAL_FLAG | NT_ADD_EXPR_PRIME,
+    /* P_ADD_EXPR_PRIME__PLUS_MULT_EXPR_ADD_EXPR_PRIME */ T_PLUS, NON_TERMINAL_FLAG | NT_MULT_EXPR, NON_TERMINAL_FLAG | NT_ADD_EXPR_PRIME,
+    /* P_ADD_EXPR_PRIME__MINUS_MULT_EXPR_ADD_EXPR_PRIME */ T_MINUS, NON_TERMINAL_FLAG | NT_MULT_EXPR, NON_TERMINAL_FLAG | NT_ADD_EXPR_PRIME,
+    /* P_MULT_EXPR__PRIMARY_EXPR_MULT_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_PRIMARY_EXPR, NON_TERMINAL_FLAG | NT_MULT_EXPR_PRIME,
+    /* P_MULT_EXPR_PRIME__MULT_PRIMARY_EXPR_MULT_EXPR_PRIME */ T_MULT, NON_TERMINAL_FLAG | NT_PRIMARY_EXPR, NON_TERMINAL_FLAG | NT_MULT_EXPR_PRIME,
+    /* P_MULT_EXPR_PRIME__DIV_PRIMARY_EXPR_MULT_EXPR_PRIME */ T_DIV, NON_TERMINAL_FLAG | NT_PRIMARY_EXPR, NON_TERMINAL_FLAG | NT_MULT_EXPR_PRIME,
+    /* P_MULT_EXPR_PRIME__MOD_PRIMARY_EXPR_MULT_EXPR_PRIME */ T_MOD, NON_TERMINAL_FLAG | NT_PRIMARY_EXPR, NON_TERMINAL_FLAG | NT_MULT_EXPR_PRIME,
+    /* P_PRIMARY_EXPR__NUMBER */ T_NUMBER,
+    /* P_PRIMARY_EXPR__STRING */ T_STRING,
+    /* P_PRIMARY_EXPR__TRUE */ T_TRUE,
+    /* P_PRIMARY_EXPR__FALSE */ T_FALSE,
+    /* P_PRIMARY_EXPR__IDENT_IDENT_SUFFIX */ T_IDENT, NON_TERMINAL_FLAG | NT_IDENT_SUFFIX,
+    /* P_PRIMARY_EXPR__LPAREN_OR_EXPR_RPAREN */ T_LPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_RPAREN,
+    /* P_PRIMARY_EXPR__NEW_IDENT_LPAREN_ARG_LIST_RPAREN */ T_NEW, T_IDENT, T_LPAREN, NON_TERMINAL_FLAG | NT_ARG_LIST, T_RPAREN,
+    /* P_IDENT_SUFFIX__LPAREN_ARG_LIST_RPAREN */ T_LPAREN, NON_TERMINAL_FLAG | NT_ARG_LIST, T_RPAREN,
+    /* P_LET_EXPR__LET_BINDING_LIST_IN_OR_EXPR */ T_LET, NON_TERMINAL_FLAG | NT_BINDING_LIST, T_IN, NON_TERMINAL_FLAG | NT_OR_EXPR,
+    /* P_IF_EXPR__IF_LPAREN_OR_EXPR_RPAREN_OR_EXPR_ELSE_PART */ T_IF, T_LPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_RPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, NON_TERMINAL_FLAG | NT_ELSE_PART,
+    /* P_ELSE_PART__ELSE_OR_EXPR */ T_ELSE, NON_TERMINAL_FLAG | NT_OR_EXPR,
+    /* P_ELSE_PART__ELIF_LPAREN_OR_EXPR_RPAREN_OR_EXPR_ELSE_PART */ T_ELIF, T_LPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_RPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, NON_TERMINAL_FLAG | NT_ELSE_PART,
+    /* P_WHILE_EXPR__WHILE_LPAREN_OR_EXPR_RPAREN_OR_EXPR */ T_WHILE, T_LPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_RPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR,
+    /* P_FOR_EXPR__FOR_LPAREN_IDENT_IN_OR_EXPR_RPAREN_OR_EXPR */ T_FOR, T_LPAREN, T_IDENT, T_IN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_RPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR,
+    /* P_BLOCK_EXPR__LBRACE_STMT_LIST_RBRACE */ T_LBRACE, NON_TERMINAL_FLAG | NT_STMT_LIST, T_RBRACE,
+    /* P_FUNCTION_DECL__FUNCTION_IDENT_LPAREN_PARAM_LIST_RPAREN_FUNCTION_BODY */ T_FUNCTION, T_IDENT, T_LPAREN, NON_TERMINAL_FLAG | NT_PARAM_LIST, T_RPAREN, NON_TERMINAL_FLAG | NT_FUNCTION_BODY,
+    /* P_FUNCTION_BODY__ARROW_OR_EXPR_SEMICOLON */ T_ARROW, NON_TERMINAL_FLAG | NT_OR_EXPR, T_SEMICOLON,
+    /* P_FUNCTION_BODY__BLOCK_EXPR */ NON_TERMINAL_FLAG | NT_BLOCK_EXPR,
+    /* P_PARAM_LIST__IDENT_PARAM_LIST_PRIME */ T_IDENT, NON_TERMINAL_FLAG | NT_PARAM_LIST_PRIME,
+    /* P_PARAM_LIST_PRIME__COMMA_IDENT_PARAM_LIST_PRIME */ T_COMMA, T_IDENT, NON_TERMINAL_FLAG | NT_PARAM_LIST_PRIME,
+    /* P_ARG_LIST__OR_EXPR_ARG_LIST_PRIME */ NON_TERMINAL_FLAG | NT_OR_EXPR, NON_TERMINAL_FLAG | NT_ARG_LIST_PRIME,
+    /* P_ARG_LIST_PRIME__COMMA_OR_EXPR_ARG_LIST_PRIME */ T_COMMA, NON_TERMINAL_FLAG | NT_OR_EXPR, NON_TERMINAL_FLAG | NT_ARG_LIST_PRIME,
+    /* P_BINDING_LIST__BINDING_BINDING_LIST_PRIME */ NON_TERMINAL_FLAG | NT_BINDING, NON_TERMINAL_FLAG | NT_BINDING_LIST_PRIME,
+    /* P_BINDING_LIST_PRIME__COMMA_BINDING_BINDING_LIST_PRIME */ T_COMMA, NON_TERMINAL_FLAG | NT_BINDING, NON_TERMINAL_FLAG | NT_BINDING_LIST_PRIME,
+    /* P_BINDING__IDENT_ASSIGN_DESTRUCT_OR_EXPR */ T_IDENT, T_ASSIGN_DESTRUCT, NON_TERMINAL_FLAG | NT_OR_EXPR,
+};
+
+inline constexpr SymbolId REVERSED_RHS_CODES[] = {
+    /* P_PROGRAM__STMT_LIST */ NON_TERMINAL_FLAG | NT_STMT_LIST,
+    /* P_STMT_LIST__STMT_STMT_LIST */ NON_TERMINAL_FLAG | NT_STMT_LIST, NON_TERMINAL_FLAG | NT_STMT,
+    /* P_STMT__DECL */ NON_TERMINAL_FLAG | NT_DECL,
+    /* P_STMT__LET_EXPR_SEMICOLON */ T_SEMICOLON, NON_TERMINAL_FLAG | NT_LET_EXPR,
+    /* P_STMT__IF_EXPR_SEMICOLON */ T_SEMICOLON, NON_TERMINAL_FLAG | NT_IF_EXPR,
+    /* P_STMT__WHILE_EXPR_SEMICOLON */ T_SEMICOLON, NON_TERMINAL_FLAG | NT_WHILE_EXPR,
+    /* P_STMT__FOR_EXPR_SEMICOLON */ T_SEMICOLON, NON_TERMINAL_FLAG | NT_FOR_EXPR,
+    /* P_STMT__BLOCK_EXPR_SEMICOLON */ T_SEMICOLON, NON_TERMINAL_FLAG | NT_BLOCK_EXPR,
+    /* P_STMT__OR_EXPR_SEMICOLON */ T_SEMICOLON, NON_TERMINAL_FLAG | NT_OR_EXPR,
+    /* P_DECL__FUNCTION_DECL */ NON_TERMINAL_FLAG | NT_FUNCTION_DECL,
+    /* P_OR_EXPR__AND_EXPR_OR_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_OR_EXPR_PRIME, NON_TERMINAL_FLAG | NT_AND_EXPR,
+    /* P_OR_EXPR_PRIME__OR_AND_EXPR_OR_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_OR_EXPR_PRIME, NON_TERMINAL_FLAG | NT_AND_EXPR, T_OR,
+    /* P_AND_EXPR__EQ_EXPR_AND_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_AND_EXPR_PRIME, NON_TERMINAL_FLAG | NT_EQ_EXPR,
+    /* P_AND_EXPR_PRIME__AND_EQ_EXPR_AND_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_AND_EXPR_PRIME, NON_TERMINAL_FLAG | NT_EQ_EXPR, T_AND,
+    /* P_EQ_EXPR__REL_EXPR_EQ_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_EQ_EXPR_PRIME, NON_TERMINAL_FLAG | NT_REL_EXPR,
+    /* P_EQ_EXPR_PRIME__EQ_REL_EXPR_EQ_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_EQ_EXPR_PRIME, NON_TERMINAL_FLAG | NT_REL_EXPR, T_EQ,
+    /* P_EQ_EXPR_PRIME__NEQ_REL_EXPR_EQ_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_EQ_EXPR_PRIME, NON_TERMINAL_FLAG | NT_REL_EXPR, T_NEQ,
+    /* P_REL_EXPR__ARITH_EXPR_REL_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME, NON_TERMINAL_FLAG | NT_ARITH_EXPR,
+    /* P_REL_EXPR_PRIME__LESS_THAN_ARITH_EXPR_REL_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME, NON_TERMINAL_FLAG | NT_ARITH_EXPR, T_LESS_THAN,
+    /* P_REL_EXPR_PRIME__GREATER_THAN_ARITH_EXPR_REL_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME, NON_TERMINAL_FLAG | NT_ARITH_EXPR, T_GREATER_THAN,
+    /* P_REL_EXPR_PRIME__LE_ARITH_EXPR_REL_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME, NON_TERMINAL_FLAG | NT_ARITH_EXPR, T_LE,
+    /* P_REL_EXPR_PRIME__GE_ARITH_EXPR_REL_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_REL_EXPR_PRIME, NON_TERMINAL_FLAG | NT_ARITH_EXPR, T_GE,
+    /* P_ARITH_EXPR__ADD_EXPR */ NON_TERMINAL_FLAG | NT_ADD_EXPR,
+    /* P_ADD_EXPR__MULT_EXPR_ADD_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_ADD_EXPR_PRIME, NON_TERMINAL_FLAG | NT_MULT_EXPR,
+    /* P_ADD_EXPR_PRIME__PLUS_MULT_EXPR_ADD_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_ADD_EXPR_PRIME, NON_TERMINAL_FLAG | NT_MULT_EXPR, T_PLUS,
+    /* P_ADD_EXPR_PRIME__MINUS_MULT_EXPR_ADD_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_ADD_EXPR_PRIME, NON_TERMINAL_FLAG | NT_MULT_EXPR, T_MINUS,
+    /* P_MULT_EXPR__PRIMARY_EXPR_MULT_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_MULT_EXPR_PRIME, NON_TERMINAL_FLAG | NT_PRIMARY_EXPR,
+    /* P_MULT_EXPR_PRIME__MULT_PRIMARY_EXPR_MULT_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_MULT_EXPR_PRIME, NON_TERMINAL_FLAG | NT_PRIMARY_EXPR, T_MULT,
+    /* P_MULT_EXPR_PRIME__DIV_PRIMARY_EXPR_MULT_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_MULT_EXPR_PRIME, NON_TERMINAL_FLAG | NT_PRIMARY_EXPR, T_DIV,
+    /* P_MULT_EXPR_PRIME__MOD_PRIMARY_EXPR_MULT_EXPR_PRIME */ NON_TERMINAL_FLAG | NT_MULT_EXPR_PRIME, NON_TERMINAL_FLAG | NT_PRIMARY_EXPR, T_MOD,
+    /* P_PRIMARY_EXPR__NUMBER */ T_NUMBER,
+    /* P_PRIMARY_EXPR__STRING */ T_STRING,
+    /* P_PRIMARY_EXPR__TRUE */ T_TRUE,
+    /* P_PRIMARY_EXPR__FALSE */ T_FALSE,
+    /* P_PRIMARY_EXPR__IDENT_IDENT_SUFFIX */ NON_TERMINAL_FLAG | NT_IDENT_SUFFIX, T_IDENT,
+    /* P_PRIMARY_EXPR__LPAREN_OR_EXPR_RPAREN */ T_RPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_LPAREN,
+    /* P_PRIMARY_EXPR__NEW_IDENT_LPAREN_ARG_LIST_RPAREN */ T_RPAREN, NON_TERMINAL_FLAG | NT_ARG_LIST, T_LPAREN, T_IDENT, T_NEW,
+    /* P_IDENT_SUFFIX__LPAREN_ARG_LIST_RPAREN */ T_RPAREN, NON_TERMINAL_FLAG | NT_ARG_LIST, T_LPAREN,
+    /* P_LET_EXPR__LET_BINDING_LIST_IN_OR_EXPR */ NON_TERMINAL_FLAG | NT_OR_EXPR, T_IN, NON_TERMINAL_FLAG | NT_BINDING_LIST, T_LET,
+    /* P_IF_EXPR__IF_LPAREN_OR_EXPR_RPAREN_OR_EXPR_ELSE_PART */ NON_TERMINAL_FLAG | NT_ELSE_PART, NON_TERMINAL_FLAG | NT_OR_EXPR, T_RPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_LPAREN, T_IF,
+    /* P_ELSE_PART__ELSE_OR_EXPR */ NON_TERMINAL_FLAG | NT_OR_EXPR, T_ELSE,
+    /* P_ELSE_PART__ELIF_LPAREN_OR_EXPR_RPAREN_OR_EXPR_ELSE_PART */ NON_TERMINAL_FLAG | NT_ELSE_PART, NON_TERMINAL_FLAG | NT_OR_EXPR, T_RPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_LPAREN, T_ELIF,
+    /* P_WHILE_EXPR__WHILE_LPAREN_OR_EXPR_RPAREN_OR_EXPR */ NON_TERMINAL_FLAG | NT_OR_EXPR, T_RPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_LPAREN, T_WHILE,
+    /* P_FOR_EXPR__FOR_LPAREN_IDENT_IN_OR_EXPR_RPAREN_OR_EXPR */ NON_TERMINAL_FLAG | NT_OR_EXPR, T_RPAREN, NON_TERMINAL_FLAG | NT_OR_EXPR, T_IN, T_IDENT, T_LPAREN, T_FOR,
+    /* P_BLOCK_EXPR__LBRACE_STMT_LIST_RBRACE */ T_RBRACE, NON_TERMINAL_FLAG | NT_STMT_LIST, T_LBRACE,
+    /* P_FUNCTION_DECL__FUNCTION_IDENT_LPAREN_PARAM_LIST_RPAREN_FUNCTION_BODY */ NON_TERMINAL_FLAG | NT_FUNCTION_BODY, T_RPAREN, NON_TERMINAL_FLAG | NT_PARAM_LIST, T_LPAREN, T_IDENT, T_FUNCTION,
+    /* P_FUNCTION_BODY__ARROW_OR_EXPR_SEMICOLON */ T_SEMICOLON, NON_TERMINAL_FLAG | NT_OR_EXPR, T_ARROW,
+    /* P_FUNCTION_BODY__BLOCK_EXPR */ NON_TERMINAL_FLAG | NT_BLOCK_EXPR,
+    /* P_PARAM_LIST__IDENT_PARAM_LIST_PRIME */ NON_TERMINAL_FLAG | NT_PARAM_LIST_PRIME, T_IDENT,
+    /* P_PARAM_LIST_PRIME__COMMA_IDENT_PARAM_LIST_PRIME */ NON_TERMINAL_FLAG | NT_PARAM_LIST_PRIME, T_IDENT, T_COMMA,
+    /* P_ARG_LIST__OR_EXPR_ARG_LIST_PRIME */ NON_TERMINAL_FLAG | NT_ARG_LIST_PRIME, NON_TERMINAL_FLAG | NT_OR_EXPR,
+    /* P_ARG_LIST_PRIME__COMMA_OR_EXPR_ARG_LIST_PRIME */ NON_TERMINAL_FLAG | NT_ARG_LIST_PRIME, NON_TERMINAL_FLAG | NT_OR_EXPR, T_COMMA,
+    /* P_BINDING_LIST__BINDING_BINDING_LIST_PRIME */ NON_TERMINAL_FLAG | NT_BINDING_LIST_PRIME, NON_TERMINAL_FLAG | NT_BINDING,
+    /* P_BINDING_LIST_PRIME__COMMA_BINDING_BINDING_LIST_PRIME */ NON_TERMINAL_FLAG | NT_BINDING_LIST_PRIME, NON_TERMINAL_FLAG | NT_BINDING, T_COMMA,
+    /* P_BINDING__IDENT_ASSIGN_DESTRUCT_OR_EXPR */ NON_TERMINAL_FLAG | NT_OR_EXPR, T_ASSIGN_DESTRUCT, T_IDENT,
+};
+
+inline constexpr std::uint32_t MAX_RHS_LENGTH = 7;
+
+// FIRST/FOLLOW por no terminal como bitsets de terminales
+inline constexpr std::uint32_t SET_WORDS = 1;
+inline constexpr std::uint64_t FIRST_SETS[NON_TERMINAL_COUNT][SET_WORDS] = {
+    {0x0000000172df8000ULL},
+    {0x0000000172df8000ULL},
+    {0x0000000172df8000ULL},
+    {0x0000000100000000ULL},
+    {0x0000000000800000ULL},
+    {0x0000000002000000ULL},
+    {0x0000000010000000ULL},
+    {0x0000000020000000ULL},
+    {0x0000000040000000ULL},
+    {0x00000000005f8000ULL},
+    {0x0000000100000000ULL},
+    {0x00000000005f8000ULL},
+    {0x0000000000000004ULL},
+    {0x00000000005f8000ULL},
+    {0x0000000000000008ULL},
+    {0x00000000005f8000ULL},
+    {0x0000000000000030ULL},
+    {0x00000000005f8000ULL},
+    {0x00000000000003c0ULL},
+    {0x00000000005f8000ULL},
+    {0x00000000005f8000ULL},
+    {0x0000000000000c00ULL},
+    {0x00000000005f8000ULL},
+    {0x0000000000007000ULL},
+    {0x0000000000100000ULL},
+    {0x00000000005f8000ULL},
+    {0x0000000000080000ULL},
+    {0x000000000c000000ULL},
+    {0x0000000000080000ULL},
+    {0x0000000240000000ULL},
+    {0x0000000400000000ULL},
+    {0x0000000400000000ULL},
+    {0x0000000000080000ULL},
+    {0x0000000400000000ULL},
+};
+
+inline constexpr std::uint64_t FOLLOW_SETS[NON_TERMINAL_COUNT][SET_WORDS] = {
+    {0x0000000000000001ULL},
+    {0x0000000080000001ULL},
+    {0x00000001f2df8001ULL},
+    {0x00000001f2df8001ULL},
+    {0x0000000000000002ULL},
+    {0x0000000000000002ULL},
+    {0x0000000000000002ULL},
+    {0x0000000000000002ULL},
+    {0x00000001f2df8003ULL},
+    {0x000000040d200002ULL},
+    {0x00000001f2df8001ULL},
+    {0x000000040d200006ULL},
+    {0x000000040d200002ULL},
+    {0x000000040d20000eULL},
+    {0x000000040d200006ULL},
+    {0x000000040d20003eULL},
+    {0x000000040d20000eULL},
+    {0x000000040d2003feULL},
+    {0x000000040d20003eULL},
+    {0x000000040d2003feULL},
+    {0x000000040d200ffeULL},
+    {0x000000040d2003feULL},
+    {0x000000040d207ffeULL},
+    {0x000000040d200ffeULL},
+    {0x000000040d207ffeULL},
+    {0x0000000000200000ULL},
+    {0x0000000001000000ULL},
+    {0x0000000000000002ULL},
+    {0x0000000000200000ULL},
+    {0x00000001f2df8001ULL},
+    {0x0000000000200000ULL},
+    {0x0000000000200000ULL},
+    {0x0000000401000000ULL},
+    {0x0000000001000000ULL},
+};
+
+inline constexpr std::uint8_t NULLABLE[NON_TERMINAL_COUNT] = {1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 0, 1, 1, 0, 1, 1, 0, 1};
+
+inline constexpr GrammarTables TABLES = {
+    GRAMMAR_HASH, TERMINAL_COUNT, NON_TERMINAL_COUNT, PRODUCTION_COUNT, RHS_CODE_COUNT, SET_WORDS,
+    MAX_RHS_LENGTH, START_CODE, IS_LL1,
+    SYMBOL_NAMES, sizeof(SYMBOL_NAMES) - 1, NAME_OFFSETS,
+    PRODUCTION_LHS, RHS_START, RHS_CODES, REVERSED_RHS_CODES,
+    &PARSE_TABLE[0][0], &FIRST_SETS[0][0], &FOLLOW_SETS[0][0], NULLABLE
+};
+
+// Gramática compilada a partir de estas tablas (una sola vez y sin análisis)
+inline std::shared_ptr<const CompiledGrammar> compiledGrammar() {
+    static const auto grammar = CompiledGrammar::fromTables(TABLES);
+    return grammar;
+}
+
+} // namespace HulkV3
+} // namespace LL1
@@ -169,7 +169,8 @@ Grammar ParserFactory::createIntermediateHulkGrammar() {
 }
 
 std::unique_ptr<LL1Parser> ParserFactory::createIntermediateHulkParser() {
-    Grammar grammar = createIntermediateHulkGrammar();
+    // La gramática se analiza una sola vez y se comparte entre todos los parsers
+    static const auto grammar = CompiledGrammar::compile(createIntermediateHulkGrammar());
     auto parser = std::make_unique<LL1Parser>(grammar);
     // setupIntermediateHulkSemanticActions(*parser); // TODO: Implementar cuando sea LL(1)
     return parser;
@@ -0,0 +1,444 @@
+#include "ll1_codegen.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <set>
+
+namespace LL1 {
+
+namespace {
+
+// Convierte un nombre de la gramática en un identificador C++ en mayúsculas
+std::string toConstantName(const std::string& name) {
+    std::string result;
+    for (char c : name) {
+        unsigned char uc = static_cast<unsigned char>(c);
+        result += std::isalnum(uc) ? static_cast<char>(std::toupper(uc)) : '_';
+    }
+    return result;
+}
+
+// Nombres distintos que se sanean igual (o que coinciden con uno reservado): se
+// desambiguan con un sufijo, en orden de ID
+std::vector<std::string> uniqueNames(const std::vector<std::string>& names, std::set<std::string> used = {}) {
+    std::vector<std::string> result;
+    result.reserve(names.size());
+    for (const std::string& name : names) {
+        std::string unique = name;
+        for (int suffix = 2; used.count(unique); ++suffix) {
+            unique = name + "_" + std::to_string(suffix);
+        }
+        used.insert(unique);
+        result.push_back(unique);
+    }
+    return result;
+}
+
+// Literal de cadena C++ con el nombre tal cual: comillas, barras y bytes no imprimibles
+// (también los de UTF-8) escapados en octal, que no se mezcla con lo que sigue
+std::string stringLiteral(const std::string& text) {
+    std::string literal = "\"";
+    for (char c : text) {
+        unsigned char uc = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\') {
+            literal += '\\';
+            literal += c;
+        } else if (uc < 0x20 || uc >= 0x7F) {
+            const char octal[] = {'\\', char('0' + (uc >> 6)), char('0' + ((uc >> 3) & 7)), char('0' + (uc & 7))};
+            literal.append(octal, 4);
+        } else {
+            literal += c;
+        }
+    }
+    return literal + "\"";
+}
+
+// Nombre para un comentario de una línea (/* ... */ o // ...) que no lo puede cerrar
+std::string commentText(const std::string& text) {
+    std::string safe;
+    for (char c : text) {
+        if (c == '\n' || c == '\r' || (c == '/' && !safe.empty() && safe.back() == '*')) safe += ' ';
+        if (c != '\n' && c != '\r') safe += c;
+    }
+    return safe;
+}
+
+// Expresión C++ para un código de símbolo de la pila (T_X o NON_TERMINAL_FLAG | NT_X)
+std::string symbolCodeExpr(const std::vector<std::string>& terminals, const std::vector<std::string>& nonTerminals,
+                           SymbolId code) {
+    if (code & NON_TERMINAL_FLAG) {
+        return "NON_TERMINAL_FLAG | " + nonTerminals[code & ~NON_TERMINAL_FLAG];
+    }
+    return terminals[code];
+}
+
+std::string productionText(const Production& production) {
+    std::string text = production.lhs.name + " ->";
+    for (const auto& symbol : production.rhs) {
+        text += " " + (symbol.isEpsilon() ? std::string("ε") : symbol.name);
+    }
+    return commentText(text);
+}
+
+void writeWords(std::ostream& out, const std::uint64_t* words, size_t count) {
+    out << "{";
+    for (size_t w = 0; w < count; ++w) {
+        if (w > 0) out << ", ";
+        out << "0x" << std::hex << std::setw(16) << std::setfill('0') << words[w] << std::dec << "ULL";
+    }
+    out << "}";
+}
+
+} // namespace
+
+std::vector<std::string> CodeGenerator::terminalConstants(const CompiledGrammar& grammar) {
+    const SymbolTable& symbols = grammar.getSymbolTable();
+    std::vector<std::string> names;
+    for (size_t t = END_OF_INPUT_ID + 1; t < symbols.terminalCount(); ++t) {
+        names.push_back("T_" + toConstantName(symbols.terminalName(SymbolId(t))));
+    }
+    // T_END_OF_INPUT queda reservado para '$', el terminal 0
+    names = uniqueNames(names, {"T_END_OF_INPUT"});
+    names.insert(names.begin(), "T_END_OF_INPUT");
+    return names;
+}
+
+std::vector<std::string> CodeGenerator::nonTerminalConstants(const CompiledGrammar& grammar) {
+    const SymbolTable& symbols = grammar.getSymbolTable();
+    std::vector<std::string> names;
+    for (size_t n = 0; n < symbols.nonTerminalCount(); ++n) {
+        names.push_back("NT_" + toConstantName(symbols.nonTerminalName(SymbolId(n))));
+    }
+    return uniqueNames(names);
+}
+
+std::vector<std::string> CodeGenerator::productionConstants(const CompiledGrammar& grammar) {
+    std::vector<std::string> names;
+    for (const auto& production : grammar.getProductions()) {
+        std::string name = "P_" + toConstantName(production.lhs.name) + "_";
+        if (production.isEpsilonProduction()) {
+            name += "_EPSILON";
+        } else {
+            for (const auto& symbol : production.rhs) {
+                name += "_" + toConstantName(symbol.name);
+            }
+        }
+        names.push_back(name);
+    }
+    return uniqueNames(names);
+}
+
+std::vector<std::string> CodeGenerator::parseFunctionNames(const CompiledGrammar& grammar) {
+    const SymbolTable& symbols = grammar.getSymbolTable();
+    std::vector<std::string> names;
+    for (size_t n = 0; n < symbols.nonTerminalCount(); ++n) {
+        std::string name = "parse_";
+        for (char c : symbols.nonTerminalName(SymbolId(n))) {
+            unsigned char uc = static_cast<unsigned char>(c);
+            name += std::isalnum(uc) ? c : '_';
+        }
+        names.push_back(name);
+    }
+    return uniqueNames(names);
+}
+
+void CodeGenerator::writeTablesHeader(const CompiledGrammar& grammar, const std::string& namespaceName,
+                                      const std::string& source, std::ostream& out) {
+    const SymbolTable& symbols = grammar.getSymbolTable();
+    const auto& productions = grammar.getProductions();
+    const size_t T = symbols.terminalCount();
+    const size_t N = symbols.nonTerminalCount();
+    const size_t P = productions.size();
+    const size_t setWords = (T + 63) / 64;
+    const std::vector<std::string> terminalNames = terminalConstants(grammar);
+    const std::vector<std::string> nonTerminalNames = nonTerminalConstants(grammar);
+    const std::vector<std::string> productionNames = productionConstants(grammar);
+    
+    out << "// Generado por generate_tables a partir de " << source << ".\n"
+        << "// No editar a mano: regenerar con 'make generate-tables'.\n"
+        << "#pragma once\n\n"
+        << "#include \"ll1_compiled_grammar.hpp\"\n\n"
+        << "namespace LL1 {\n"
+        << "namespace " << namespaceName << " {\n\n";
+    
+    out << "inline constexpr std::uint64_t GRAMMAR_HASH = 0x" << std::hex << std::setw(16) << std::setfill('0')
+        << grammar.getGrammarHash() << std::dec << "ULL;\n"
+        << "inline constexpr bool IS_LL1 = " << (grammar.isLL1() ? "true" : "false") << ";\n\n";
+    
+    // === Enums ===
+    out << "enum Terminal : SymbolId {\n";
+    for (size_t t = 0; t < T; ++t) {
+        out << "    " << terminalNames[t] << " = " << t << ",\n";
+    }
+    out << "    TERMINAL_COUNT = " << T << "\n};\n\n";
+    
+    out << "enum NonTerminal : SymbolId {\n";
+    for (size_t n = 0; n < N; ++n) {
+        out << "    " << nonTerminalNames[n] << " = " << n << ",\n";
+    }
+    out << "    NON_TERMINAL_COUNT = " << N << "\n};\n\n";
+    
+    size_t nameWidth = 0;
+    for (const auto& name : productionNames) nameWidth = std::max(nameWidth, name.size());
+    out << "enum Production : std::uint16_t {\n";
+    for (size_t p = 0; p < P; ++p) {
+        std::string entry = productionNames[p] + " = " + std::to_string(p) + ",";
+        out << "    " << std::left << std::setw(int(nameWidth) + 8) << std::setfill(' ') << entry << std::right
+            << "// " << productionText(productions[p]) << "\n";
+    }
+    out << "    PRODUCTION_COUNT = " << P << "\n};\n\n";
+    
+    out << "inline constexpr SymbolId START_CODE = " << symbolCodeExpr(terminalNames, nonTerminalNames, grammar.getStartCode()) << ";\n"
+        << "inline constexpr std::uint16_t NO_PRODUCTION = DenseParseTable::NO_PRODUCTION;\n\n";
+    
+    // === Nombres de símbolos ===
+    // Terminales desde el ID 1 y después no terminales, terminados en '\0' (GrammarTables)
+    out << "inline constexpr char SYMBOL_NAMES[] =\n";
+    std::vector<size_t> nameOffsets;
+    size_t namesSize = 0;
+    for (size_t i = 1; i < T + N; ++i) {
+        const std::string& name = i < T ? symbols.terminalName(SymbolId(i)) : symbols.nonTerminalName(SymbolId(i - T));
+        nameOffsets.push_back(namesSize);
+        namesSize += name.size() + 1;
+        out << "    " << stringLiteral(name + '\0') << (i + 1 < T + N ? "\n" : ";\n\n");
+    }
+    
+    out << "inline constexpr std::uint32_t NAME_OFFSETS[TERMINAL_COUNT - 1 + NON_TERMINAL_COUNT] = {";
+    for (size_t i = 0; i < nameOffsets.size(); ++i) {
+        out << (i % 16 == 0 ? "\n    " : " ") << nameOffsets[i] << ",";
+    }
+    out << "\n};\n\n";
+    
+    // === Tabla de predicción ===
+    out << "// Tabla de predicción densa: PARSE_TABLE[no terminal][terminal]\n"
+        << "inline constexpr std::uint16_t PARSE_TABLE[NON_TERMINAL_COUNT][TERMINAL_COUNT] = {\n";
+    for (size_t n = 0; n < N; ++n) {
+        out << "    /* " << commentText(symbols.nonTerminalName(SymbolId(n))) << " */ {";
+        for (size_t t = 0; t < T; ++t) {
+            if (t > 0) out << ", ";
+            const int cell = grammar.predict(SymbolId(n), SymbolId(t));
+            if (cell < 0) {
+                out << "NO_PRODUCTION";
+            } else {
+                out << cell;
+            }
+        }
+        out << "},\n";
+    }
+    out << "};\n\n";
+    
+    out << "constexpr int predict(NonTerminal nonTerminal, Terminal terminal) {\n"
+        << "    return PARSE_TABLE[nonTerminal][terminal] == NO_PRODUCTION ? -1 : PARSE_TABLE[nonTerminal][terminal];\n"
+        << "}\n\n";
+    
+    // === Producciones aplanadas ===
+    out << "// Producciones aplanadas: lado izquierdo y códigos del lado derecho (sin ε),\n"
+        << "// el de p en RHS_CODES[RHS_START[p] .. RHS_START[p + 1])\n"
+        << "inline constexpr SymbolId PRODUCTION_LHS[PRODUCTION_COUNT] = {\n";
+    for (size_t p = 0; p < P; ++p) {
+        out << "    " << nonTerminalNames[grammar.lhs(int(p))] << ",\n";
+    }
+    out << "};\n\n";
+    
+    out << "inline constexpr std::uint32_t RHS_START[PRODUCTION_COUNT + 1] = {\n";
+    size_t rhsCodeCount = 0;
+    for (size_t p = 0; p < P; ++p) {
+        out << "    " << rhsCodeCount << ",\n";
+        rhsCodeCount += grammar.rhsLength(int(p));
+    }
+    out << "    " << rhsCodeCount << "\n};\n\n";
+    
+    out << "inline constexpr std::uint32_t RHS_CODE_COUNT = " << rhsCodeCount << ";\n"
+        << "inline constexpr SymbolId RHS_CODES[] = {\n";
+    for (size_t p = 0; p < P; ++p) {
+        if (grammar.rhsLength(int(p)) == 0) continue;
+        out << "    /* " << productionNames[p] << " */";
+        for (const SymbolId* it = grammar.rhsBegin(int(p)); it != grammar.rhsEnd(int(p)); ++it) {
+            out << " " << symbolCodeExpr(terminalNames, nonTerminalNames, *it) << ",";
+        }
+        out << "\n";
+    }
+    if (rhsCodeCount == 0) out << "    0    // sin símbolos (todas las producciones son ε)\n";
+    out << "};\n\n";
+    
+    // Los mismos lados derechos invertidos, como los apila el parser
+    out << "inline constexpr SymbolId REVERSED_RHS_CODES[] = {\n";
+    for (size_t p = 0; p < P; ++p) {
+        if (grammar.rhsLength(int(p)) == 0) continue;
+        out << "    /* " << productionNames[p] << " */";
+        for (const SymbolId* it = grammar.reversedRhsBegin(int(p)); it != grammar.reversedRhsEnd(int(p)); ++it) {
+            out << " " << symbolCodeExpr(terminalNames, nonTerminalNames, *it) << ",";
+        }
+        out << "\n";
+    }
+    if (rhsCodeCount == 0) out << "    0\n";
+    out << "};\n\n"
+        << "inline constexpr std::uint32_t MAX_RHS_LENGTH = " << grammar.maxRhsLength() << ";\n\n";
+    
+    // === FIRST/FOLLOW ===
+    out << "// FIRST/FOLLOW por no terminal como bitsets de terminales\n"
+        << "inline constexpr std::uint32_t SET_WORDS = " << setWords << ";\n"
+        << "inline constexpr std::uint64_t FIRST_SETS[NON_TERMINAL_COUNT][SET_WORDS] = {\n";
+    for (size_t n = 0; n < N; ++n) {
+        out << "    ";
+        writeWords(out, grammar.first(SymbolId(n)).data(), setWords);
+        out << ",\n";
+    }
+    out << "};\n\n"
+        << "inline constexpr std::uint64_t FOLLOW_SETS[NON_TERMINAL_COUNT][SET_WORDS] = {\n";
+    for (size_t n = 0; n < N; ++n) {
+        out << "    ";
+        writeWords(out, grammar.follow(SymbolId(n)).data(), setWords);
+        out << ",\n";
+    }
+    out << "};\n\n"
+        << "inline constexpr std::uint8_t NULLABLE[NON_TERMINAL_COUNT] = {";
+    for (size_t n = 0; n < N; ++n) {
+        if (n > 0) out << ", ";
+        out << (grammar.first(SymbolId(n)).isNullable() ? 1 : 0);
+    }
+    out << "};\n\n";
+    
+    // === Gramática compilada ===
+    out << "inline constexpr GrammarTables TABLES = {\n"
+        << "    GRAMMAR_HASH, TERMINAL_COUNT, NON_TERMINAL_COUNT, PRODUCTION_COUNT, RHS_CODE_COUNT, SET_WORDS,\n"
+        << "    MAX_RHS_LENGTH, START_CODE, IS_LL1,\n"
+        << "    SYMBOL_NAMES, sizeof(SYMBOL_NAMES) - 1, NAME_OFFSETS,\n"
+        << "    PRODUCTION_LHS, RHS_START, RHS_CODES, REVERSED_RHS_CODES,\n"
+        << "    &PARSE_TABLE[0][0], &FIRST_SETS[0][0], &FOLLOW_SETS[0][0], NULLABLE\n"
+        << "};\n\n"
+        << "// Gramática compilada a partir de estas tablas (una sola vez y sin análisis)\n"
+        << "inline std::shared_ptr<const CompiledGrammar> compiledGrammar() {\n"
+        << "    static const auto grammar = CompiledGrammar::fromTables(TABLES);\n"
+        << "    return grammar;\n"
+        << "}\n\n"
+        << "} // namespace " << namespaceName << "\n"
+        << "} // namespace LL1\n";
+}
+
+void CodeGenerator::writeRecursiveDescentParser(const CompiledGrammar& grammar, const std::string& namespaceName,
+                                                const std::string& tablesHeader, const std::string& source,
+                                                std::ostream& out) {
+    const SymbolTable& symbols = grammar.getSymbolTable();
+    const auto& productions = grammar.getProductions();
+    const size_t T = symbols.terminalCount();
+    const size_t N = symbols.nonTerminalCount();
+    const std::vector<std::string> terminalNames = terminalConstants(grammar);
+    const std::vector<std::string> nonTerminalNames = nonTerminalConstants(grammar);
+    const std::vector<std::string> productionNames = productionConstants(grammar);
+    const std::vector<std::string> functionNames = parseFunctionNames(grammar);
+    
+    out << "// Generado por generate_tables a partir de " << source << ".\n"
+        << "// No editar a mano: regenerar con 'make generate-tables'.\n"
+        << "//\n"
+        << "// Parser descendente recursivo equivalente al intérprete de LL1Parser::parseInternal:\n"
+        << "// misma secuencia de acciones semánticas, mismos terminales consumidos y mismos errores.\n"
+        << "#pragma once\n\n"
+        << "#include \"ll1_parser.hpp\"\n"
+        << "#include \"" << tablesHeader << "\"\n"
+        << "#include <stdexcept>\n\n"
+        << "namespace LL1 {\n"
+        << "namespace " << namespaceName << " {\n"
+        << "namespace RecursiveDescent {\n\n";
+    
+    for (size_t n = 0; n < N; ++n) {
+        out << "inline void " << functionNames[n] << "(ParseContext& ctx);\n";
+    }
+    out << "\n";
+    
+    for (size_t n = 0; n < N; ++n) {
+        const SymbolId nonTerminal = SymbolId(n);
+        const SymbolId selfCode = SymbolId(nonTerminal | NON_TERMINAL_FLAG);
+        
+        // Terminales que predicen cada producción de este no terminal, en orden de ID
+        std::vector<std::vector<SymbolId>> lookaheads(productions.size());
+        bool selfTail = false;
+        for (size_t t = 0; t < T; ++t) {
+            const int cell = grammar.predict(nonTerminal, SymbolId(t));
+            if (cell < 0) continue;
+            lookaheads[cell].push_back(SymbolId(t));
+            if (grammar.rhsLength(cell) > 0 && *(grammar.rhsEnd(cell) - 1) == selfCode) selfTail = true;
+        }
+        
+        // Con recursión por la derecha sobre sí mismo el cuerpo es un bucle: la última
+        // llamada se convierte en 'continue' y la profundidad no crece con la entrada
+        const std::string indent = selfTail ? "        " : "    ";
+        out << "inline void " << functionNames[nonTerminal] << "(ParseContext& ctx) {\n";
+        if (selfTail) out << "    for (;;) {\n";
+        out << indent << "switch (ctx.lookahead()) {\n";
+        
+        for (size_t p = 0; p < productions.size(); ++p) {
+            if (lookaheads[p].empty()) continue;
+            for (SymbolId t : lookaheads[p]) {
+                out << indent << "case " << terminalNames[t] << ":\n";
+            }
+            out << indent << "    ctx.predict(" << productionNames[p] << ");\n";
+            
+            bool continues = false;
+            for (const SymbolId* it = grammar.rhsBegin(int(p)); it != grammar.rhsEnd(int(p)); ++it) {
+                if (!(*it & NON_TERMINAL_FLAG)) {
+                    out << indent << "    ctx.match(" << terminalNames[*it] << ");\n";
+                } else if (*it == selfCode && it + 1 == grammar.rhsEnd(int(p))) {
+                    continues = true;
+                } else {
+                    out << indent << "    " << functionNames[*it & ~NON_TERMINAL_FLAG] << "(ctx);\n";
+                }
+            }
+            out << indent << "    " << (continues ? "continue;" : "return;") << "\n";
+        }
+        
+        out << indent << "default:\n"
+            << indent << "    ctx.noRule(" << nonTerminalNames[nonTerminal] << ");\n"
+            << indent << "}\n";
+        if (selfTail) out << "    }\n";
+        out << "}\n\n";
+    }
+    
+    out << "} // namespace RecursiveDescent\n\n"
+        << "// Punto de entrada para LL1Parser::setGeneratedParser(parse, GRAMMAR_HASH, parseFrom)\n"
+        << "inline void parse(ParseContext& ctx) {\n"
+        << "    RecursiveDescent::" << functionNames[grammar.getStartCode() & ~NON_TERMINAL_FLAG] << "(ctx);\n"
+        << "}\n\n";
+    
+    // Entrada por un no terminal cualquiera, para analizar trozos de la entrada
+    out << "// Análisis a partir de cualquier no terminal (LL1Parser::setStatementThreads)\n"
+        << "inline void parseFrom(ParseContext& ctx, SymbolId nonTerminal) {\n"
+        << "    switch (nonTerminal) {\n";
+    for (size_t n = 0; n < N; ++n) {
+        out << "    case " << nonTerminalNames[n] << ":\n"
+            << "        RecursiveDescent::" << functionNames[n] << "(ctx);\n"
+            << "        return;\n";
+    }
+    out << "    default:\n"
+        << "        throw std::out_of_range(\"No generated function for non-terminal \" + std::to_string(nonTerminal));\n"
+        << "    }\n"
+        << "}\n\n"
+        << "} // namespace " << namespaceName << "\n"
+        << "} // namespace LL1\n";
+}
+
+bool CodeGenerator::writeFileIfChanged(const std::string& path, const std::string& content) {
+    {
+        std::ifstream existing(path, std::ios::binary);
+        std::ostringstream current;
+        current << existing.rdbuf();
+        if (existing && current.str() == content) {
+            std::cout << path << " is up to date" << std::endl;
+            return true;
+        }
+    }
+    
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << content;
+    if (!out) {
+        std::cerr << "Could not write " << path << std::endl;
+        return false;
+    }
+    std::cout << "Generated " << path << std::endl;
+    return true;
+}
+
+} // namespace LL1
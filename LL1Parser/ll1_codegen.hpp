@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ll1_compiled_grammar.hpp"
+#include <ostream>
+
+namespace LL1 {
+
+// Generación de código C++ a partir de una gramática compilada (ver generate_tables.cpp)
+class CodeGenerator {
+public:
+    // Encabezado con enums de terminales, no terminales y producciones, la tabla densa
+    // y los lados derechos aplanados como arrays constexpr, y una función que devuelve
+    // la CompiledGrammar equivalente sin analizar la gramática en tiempo de ejecución.
+    // `source` describe de dónde salió la gramática (va en el comentario inicial).
+    static void writeTablesHeader(const CompiledGrammar& grammar, const std::string& namespaceName,
+                                  const std::string& source, std::ostream& out);
+
+    // Parser descendente recursivo especializado: una función inline por no terminal que
+    // decide con un switch sobre el lookahead, consume los terminales en línea y llama
+    // a las acciones semánticas a través de ParseContext. La recursión por la derecha de
+    // un no terminal sobre sí mismo se genera como un bucle. Usa las constantes del
+    // encabezado de tablas `tablesHeader` (mismo namespace) y expone
+    // `void parse(ParseContext&)` para LL1Parser::setGeneratedParser.
+    static void writeRecursiveDescentParser(const CompiledGrammar& grammar, const std::string& namespaceName,
+                                            const std::string& tablesHeader, const std::string& source,
+                                            std::ostream& out);
+
+    // Nombres de las constantes generadas, por ID: T_NUMBER, NT_PRIMARY_EXPR,
+    // P_PRIMARY_EXPR__NUMBER, P_STMT_LIST__EPSILON... y de las funciones parse_*. Cada
+    // nombre de la gramática se sanea a un identificador; los que coinciden tras
+    // sanearse se distinguen con un sufijo (_2, _3...)
+    static std::vector<std::string> terminalConstants(const CompiledGrammar& grammar);
+    static std::vector<std::string> nonTerminalConstants(const CompiledGrammar& grammar);
+    static std::vector<std::string> productionConstants(const CompiledGrammar& grammar);
+    static std::vector<std::string> parseFunctionNames(const CompiledGrammar& grammar);
+    
+    // Escribe `content` en `path` salvo que ya tenga exactamente ese contenido, para no
+    // forzar recompilaciones. Informa por std::cout/std::cerr y devuelve false si falla.
+    static bool writeFileIfChanged(const std::string& path, const std::string& content);
+};
+
+} // namespace LL1
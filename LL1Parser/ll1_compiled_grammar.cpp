@@ -0,0 +1,417 @@
+#include "ll1_compiled_grammar.hpp"
+#include "ll1_mapped_file.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unordered_set>
+
+namespace LL1 {
+
+// === Caché binaria ===
+//
+// Formato v2, en el orden de bytes nativo y con cada sección alineada a 8 bytes:
+//   CacheHeader
+//   names            : nombres de terminales (desde el ID 1) y de no terminales, terminados en '\0'
+//   nameOffsets      : uint32 por nombre, su posición en names
+//   lhs              : uint16 por producción
+//   rhsStart         : uint32 por producción, más el final
+//   rhsCodes         : uint16 por símbolo de lado derecho (sin ε)
+//   reversedRhsCodes : los mismos, cada lado derecho invertido
+//   table            : uint16 por celda, no terminales × terminales
+//   first            : setWords palabras uint64 por no terminal
+//   follow           : setWords palabras uint64 por no terminal
+//   nullable         : uint8 por no terminal (ε ∈ FIRST)
+// El archivo se mapea en memoria y la gramática apunta a sus secciones. compile()
+// construye la misma imagen en memoria, así que todas las gramáticas se leen igual.
+
+namespace {
+
+const char CACHE_MAGIC[8] = {'L', 'L', '1', 'C', 'G', 'R', 'M', '\0'};
+const std::uint32_t CACHE_VERSION = 2;
+const std::uint32_t CACHE_BYTE_ORDER = 0x01020304;
+
+struct CacheHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint64_t grammarHash;
+    std::uint64_t fileSize;
+    std::uint32_t terminalCount;
+    std::uint32_t nonTerminalCount;
+    std::uint32_t productionCount;
+    std::uint32_t rhsCodeCount;
+    std::uint32_t setWords;
+    std::uint32_t maxRhsLength;
+    std::uint16_t startCode;
+    std::uint8_t ll1;
+    std::uint8_t reserved;
+    std::uint64_t namesOffset, namesSize;
+    std::uint64_t nameOffsetsOffset;
+    std::uint64_t lhsOffset;
+    std::uint64_t rhsStartOffset;
+    std::uint64_t rhsCodesOffset;
+    std::uint64_t reversedRhsCodesOffset;
+    std::uint64_t tableOffset;
+    std::uint64_t firstOffset;
+    std::uint64_t followOffset;
+    std::uint64_t nullableOffset;
+};
+
+// Secciones escritas en un buffer con alineación a 8 bytes
+class CacheWriter {
+public:
+    std::vector<char> buffer;
+    
+    std::uint64_t append(const void* data, size_t size) {
+        buffer.resize((buffer.size() + 7) & ~size_t(7), 0);
+        std::uint64_t offset = buffer.size();
+        const char* bytes = static_cast<const char*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+        return offset;
+    }
+};
+
+size_t nameCount(const GrammarTables& tables) {
+    return tables.terminalCount - 1 + tables.nonTerminalCount;
+}
+
+// Imagen del archivo de caché con las tablas
+std::vector<char> writeImage(const GrammarTables& tables) {
+    const size_t T = tables.terminalCount;
+    const size_t N = tables.nonTerminalCount;
+    const size_t P = tables.productionCount;
+    const size_t setBytes = size_t(tables.setWords) * sizeof(std::uint64_t);
+    
+    CacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.byteOrder = CACHE_BYTE_ORDER;
+    header.grammarHash = tables.grammarHash;
+    header.terminalCount = tables.terminalCount;
+    header.nonTerminalCount = tables.nonTerminalCount;
+    header.productionCount = tables.productionCount;
+    header.rhsCodeCount = tables.rhsCodeCount;
+    header.setWords = tables.setWords;
+    header.maxRhsLength = tables.maxRhsLength;
+    header.startCode = tables.startCode;
+    header.ll1 = tables.ll1 ? 1 : 0;
+    
+    CacheWriter writer;
+    writer.append(&header, sizeof(header));
+    header.namesOffset = writer.append(tables.names, tables.namesSize);
+    header.namesSize = tables.namesSize;
+    header.nameOffsetsOffset = writer.append(tables.nameOffsets, nameCount(tables) * sizeof(std::uint32_t));
+    header.lhsOffset = writer.append(tables.lhs, P * sizeof(SymbolId));
+    header.rhsStartOffset = writer.append(tables.rhsStart, (P + 1) * sizeof(std::uint32_t));
+    header.rhsCodesOffset = writer.append(tables.rhsCodes, tables.rhsCodeCount * sizeof(SymbolId));
+    header.reversedRhsCodesOffset = writer.append(tables.reversedRhsCodes, tables.rhsCodeCount * sizeof(SymbolId));
+    header.tableOffset = writer.append(tables.table, N * T * sizeof(std::uint16_t));
+    header.firstOffset = writer.append(tables.first, N * setBytes);
+    header.followOffset = writer.append(tables.follow, N * setBytes);
+    header.nullableOffset = writer.append(tables.nullable, N);
+    
+    header.fileSize = writer.buffer.size();
+    std::memcpy(writer.buffer.data(), &header, sizeof(header));
+    return std::move(writer.buffer);
+}
+
+bool sectionFits(const CacheHeader& header, std::uint64_t offset, std::uint64_t size) {
+    return offset % 8 == 0 && offset <= header.fileSize && size <= header.fileSize - offset;
+}
+
+// Tablas que apuntan a las secciones de una imagen (alineada a 8 bytes); false si la
+// cabecera no es de esta versión, el hash no coincide o alguna sección se sale
+bool readImage(const char* data, size_t size, std::uint64_t expectedHash, GrammarTables& tables) {
+    if (!data || size < sizeof(CacheHeader)) return false;
+    
+    CacheHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+        header.version != CACHE_VERSION || header.byteOrder != CACHE_BYTE_ORDER ||
+        header.grammarHash != expectedHash || header.fileSize != size) {
+        return false;
+    }
+    
+    const size_t T = header.terminalCount;
+    const size_t N = header.nonTerminalCount;
+    const size_t P = header.productionCount;
+    const size_t setBytes = size_t(header.setWords) * sizeof(std::uint64_t);
+    if (T == 0 || header.namesSize > UINT32_MAX ||
+        !sectionFits(header, header.namesOffset, header.namesSize) ||
+        !sectionFits(header, header.nameOffsetsOffset, (T - 1 + N) * sizeof(std::uint32_t)) ||
+        !sectionFits(header, header.lhsOffset, P * sizeof(SymbolId)) ||
+        !sectionFits(header, header.rhsStartOffset, (P + 1) * sizeof(std::uint32_t)) ||
+        !sectionFits(header, header.rhsCodesOffset, size_t(header.rhsCodeCount) * sizeof(SymbolId)) ||
+        !sectionFits(header, header.reversedRhsCodesOffset, size_t(header.rhsCodeCount) * sizeof(SymbolId)) ||
+        !sectionFits(header, header.tableOffset, N * T * sizeof(std::uint16_t)) ||
+        !sectionFits(header, header.firstOffset, N * setBytes) ||
+        !sectionFits(header, header.followOffset, N * setBytes) ||
+        !sectionFits(header, header.nullableOffset, N)) {
+        return false;
+    }
+    
+    tables.grammarHash = header.grammarHash;
+    tables.terminalCount = header.terminalCount;
+    tables.nonTerminalCount = header.nonTerminalCount;
+    tables.productionCount = header.productionCount;
+    tables.rhsCodeCount = header.rhsCodeCount;
+    tables.setWords = header.setWords;
+    tables.maxRhsLength = header.maxRhsLength;
+    tables.startCode = header.startCode;
+    tables.ll1 = header.ll1 != 0;
+    tables.names = data + header.namesOffset;
+    tables.namesSize = static_cast<std::uint32_t>(header.namesSize);
+    tables.nameOffsets = reinterpret_cast<const std::uint32_t*>(data + header.nameOffsetsOffset);
+    tables.lhs = reinterpret_cast<const SymbolId*>(data + header.lhsOffset);
+    tables.rhsStart = reinterpret_cast<const std::uint32_t*>(data + header.rhsStartOffset);
+    tables.rhsCodes = reinterpret_cast<const SymbolId*>(data + header.rhsCodesOffset);
+    tables.reversedRhsCodes = reinterpret_cast<const SymbolId*>(data + header.reversedRhsCodesOffset);
+    tables.table = reinterpret_cast<const std::uint16_t*>(data + header.tableOffset);
+    tables.first = reinterpret_cast<const std::uint64_t*>(data + header.firstOffset);
+    tables.follow = reinterpret_cast<const std::uint64_t*>(data + header.followOffset);
+    tables.nullable = reinterpret_cast<const std::uint8_t*>(data + header.nullableOffset);
+    return true;
+}
+
+// Comprueba, sin copiar nada, que los IDs y rangos de las tablas están dentro de sus
+// límites: el parser los usa sin más comprobaciones
+bool validTables(const GrammarTables& tables) {
+    const size_t T = tables.terminalCount;
+    const size_t N = tables.nonTerminalCount;
+    const size_t P = tables.productionCount;
+    if (T == 0 || N == 0 || P >= DenseParseTable::NO_PRODUCTION || tables.setWords != (T + 63) / 64) return false;
+    if ((tables.startCode & NON_TERMINAL_FLAG) == 0 || (tables.startCode & ~NON_TERMINAL_FLAG) >= N) return false;
+    
+    // Nombres terminados dentro de la sección y distintos dentro de cada clase
+    std::unordered_set<std::string_view> terminals, nonTerminals;
+    for (size_t i = 0; i < nameCount(tables); ++i) {
+        const std::uint32_t offset = tables.nameOffsets[i];
+        if (offset >= tables.namesSize) return false;
+        const void* end = std::memchr(tables.names + offset, '\0', tables.namesSize - offset);
+        if (!end) return false;
+        const std::string_view name(tables.names + offset, static_cast<const char*>(end) - (tables.names + offset));
+        if (!(i + 1 < T ? terminals : nonTerminals).insert(name).second) return false;
+    }
+    
+    // Producciones aplanadas: rangos crecientes, códigos válidos, lados invertidos
+    if (tables.rhsStart[0] != 0 || tables.rhsStart[P] != tables.rhsCodeCount) return false;
+    size_t longest = 0;
+    for (size_t p = 0; p < P; ++p) {
+        const std::uint32_t begin = tables.rhsStart[p];
+        const std::uint32_t end = tables.rhsStart[p + 1];
+        if (tables.lhs[p] >= N || begin > end) return false;
+        longest = std::max<size_t>(longest, end - begin);
+        for (std::uint32_t i = begin; i < end; ++i) {
+            const SymbolId code = tables.rhsCodes[i];
+            const SymbolId id = code & ~NON_TERMINAL_FLAG;
+            if ((code & NON_TERMINAL_FLAG) ? id >= N : id >= T) return false;
+            if (tables.reversedRhsCodes[begin + end - 1 - i] != code) return false;
+        }
+    }
+    if (longest != tables.maxRhsLength) return false;
+    
+    for (size_t cell = 0; cell < N * T; ++cell) {
+        if (tables.table[cell] != DenseParseTable::NO_PRODUCTION && tables.table[cell] >= P) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+CompiledGrammar::CompiledGrammar() = default;
+CompiledGrammar::~CompiledGrammar() = default;
+
+std::shared_ptr<const CompiledGrammar> CompiledGrammar::compile(Grammar grammar) {
+    // Si hay conflictos se conserva la tabla parcial, como hace Grammar
+    const bool ll1 = grammar.buildParseTable();
+    const DenseParseTable& parseTable = grammar.getDenseParseTable();
+    const SymbolTable& symbols = grammar.getSymbolTable();
+    const auto& productions = grammar.getProductions();
+    const size_t T = symbols.terminalCount();
+    const size_t N = symbols.nonTerminalCount();
+    const size_t words = (T + 63) / 64;
+    
+    std::string names;
+    std::vector<std::uint32_t> nameOffsets;
+    for (size_t i = 1; i < T + N; ++i) {
+        nameOffsets.push_back(static_cast<std::uint32_t>(names.size()));
+        names += i < T ? symbols.terminalName(SymbolId(i)) : symbols.nonTerminalName(SymbolId(i - T));
+        names += '\0';
+    }
+    
+    std::vector<SymbolId> lhsIds, rhsCodes, reversedRhsCodes;
+    std::vector<std::uint32_t> rhsStart;
+    size_t maxRhs = 0;
+    for (const auto& production : productions) {
+        lhsIds.push_back(production.lhs.id);
+        rhsStart.push_back(static_cast<std::uint32_t>(rhsCodes.size()));
+        for (const auto& symbol : production.rhs) {
+            if (!symbol.isEpsilon()) rhsCodes.push_back(symbol.code());
+        }
+        reversedRhsCodes.insert(reversedRhsCodes.end(), rhsCodes.rbegin(), rhsCodes.rbegin() + (rhsCodes.size() - rhsStart.back()));
+        maxRhs = std::max<size_t>(maxRhs, rhsCodes.size() - rhsStart.back());
+    }
+    rhsStart.push_back(static_cast<std::uint32_t>(rhsCodes.size()));
+    
+    std::vector<std::uint64_t> first, follow;
+    std::vector<std::uint8_t> nullable;
+    for (size_t n = 0; n < N; ++n) {
+        const TerminalSet& firstSet = grammar.getFirstBits()[n];
+        const TerminalSet& followSet = grammar.getFollowBits()[n];
+        first.insert(first.end(), firstSet.data(), firstSet.data() + words);
+        follow.insert(follow.end(), followSet.data(), followSet.data() + words);
+        nullable.push_back(firstSet.isNullable() ? 1 : 0);
+    }
+    
+    GrammarTables tables;
+    tables.grammarHash = grammar.contentHash();
+    tables.terminalCount = static_cast<std::uint32_t>(T);
+    tables.nonTerminalCount = static_cast<std::uint32_t>(N);
+    tables.productionCount = static_cast<std::uint32_t>(productions.size());
+    tables.rhsCodeCount = static_cast<std::uint32_t>(rhsCodes.size());
+    tables.setWords = static_cast<std::uint32_t>(words);
+    tables.maxRhsLength = static_cast<std::uint32_t>(maxRhs);
+    tables.startCode = grammar.getStartSymbol().code();
+    tables.ll1 = ll1;
+    tables.names = names.data();
+    tables.namesSize = static_cast<std::uint32_t>(names.size());
+    tables.nameOffsets = nameOffsets.data();
+    tables.lhs = lhsIds.data();
+    tables.rhsStart = rhsStart.data();
+    tables.rhsCodes = rhsCodes.data();
+    tables.reversedRhsCodes = reversedRhsCodes.data();
+    tables.table = parseTable.cells.data();
+    tables.first = first.data();
+    tables.follow = follow.data();
+    tables.nullable = nullable.data();
+    
+    // La gramática es dueña de la misma imagen que se guardaría en la caché
+    const std::vector<char> bytes = writeImage(tables);
+    std::shared_ptr<CompiledGrammar> compiled(new CompiledGrammar());
+    compiled->image.resize((bytes.size() + 7) / 8);
+    std::memcpy(compiled->image.data(), bytes.data(), bytes.size());
+    readImage(reinterpret_cast<const char*>(compiled->image.data()), bytes.size(), tables.grammarHash, compiled->tables);
+    return compiled;
+}
+
+std::shared_ptr<const CompiledGrammar> CompiledGrammar::compileCached(Grammar grammar, const std::string& cachePath) {
+    const std::uint64_t hash = grammar.contentHash();
+    if (auto cached = load(cachePath, hash)) {
+        return cached;
+    }
+    
+    // Caché ausente u obsoleta: recalcular y reescribirla (un fallo al escribir no es fatal)
+    auto compiled = compile(std::move(grammar));
+    compiled->save(cachePath);
+    return compiled;
+}
+
+bool CompiledGrammar::save(const std::string& path) const {
+    const std::vector<char> bytes = writeImage(tables);
+    
+    // Escribir a un temporal y renombrar, para que un lector nunca vea un archivo a medias
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        if (!out) {
+            std::cerr << "Could not write grammar cache: " << tmpPath << std::endl;
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::cerr << "Could not write grammar cache: " << path << std::endl;
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<const CompiledGrammar> CompiledGrammar::load(const std::string& path, std::uint64_t expectedHash) {
+    // El mapeo queda abierto mientras viva la gramática: las tablas apuntan dentro
+    std::shared_ptr<CompiledGrammar> compiled(new CompiledGrammar());
+    compiled->mapping.reset(new MappedFile(path));
+    const MappedFile& file = *compiled->mapping;
+    if (!readImage(file.data(), file.size(), expectedHash, compiled->tables) || !validTables(compiled->tables)) {
+        return nullptr;
+    }
+    return compiled;
+}
+
+std::shared_ptr<const CompiledGrammar> CompiledGrammar::fromTables(const GrammarTables& tables) {
+    if (!validTables(tables)) return nullptr;
+    std::shared_ptr<CompiledGrammar> compiled(new CompiledGrammar());
+    compiled->tables = tables;
+    return compiled;
+}
+
+SymbolId CompiledGrammar::findSymbol(SymbolType type, std::string_view symbolName) const {
+    if (type == SymbolType::END_OF_INPUT) return END_OF_INPUT_ID;
+    if (type == SymbolType::EPSILON) return INVALID_SYMBOL_ID;
+    
+    const bool terminal = type != SymbolType::NON_TERMINAL;
+    const size_t first = terminal ? 0 : tables.terminalCount - 1;
+    const size_t count = terminal ? tables.terminalCount - 1 : tables.nonTerminalCount;
+    for (size_t i = first; i < first + count; ++i) {
+        if (symbolName == name(i)) return static_cast<SymbolId>(terminal ? i + 1 : i - first);
+    }
+    return INVALID_SYMBOL_ID;
+}
+
+void CompiledGrammar::buildDetails() const {
+    detailsOnce.run([this] {
+        const size_t T = tables.terminalCount;
+        const size_t N = tables.nonTerminalCount;
+        
+        // Tabla de símbolos: se vuelve a internar en orden de ID
+        for (size_t i = 1; i < T + N; ++i) {
+            symbols.intern(Symbol(i < T ? SymbolType::TERMINAL : SymbolType::NON_TERMINAL, name(i - 1)));
+        }
+        
+        // Producciones con Symbol para diagnósticos y acciones semánticas
+        productions.reserve(tables.productionCount);
+        for (size_t p = 0; p < tables.productionCount; ++p) {
+            std::vector<Symbol> rhs;
+            for (const SymbolId* it = rhsBegin(int(p)); it != rhsEnd(int(p)); ++it) {
+                SymbolId id = *it & ~NON_TERMINAL_FLAG;
+                rhs.push_back((*it & NON_TERMINAL_FLAG) ? symbols.nonTerminal(id) : symbols.terminal(id));
+            }
+            if (rhs.empty()) rhs.push_back(EPSILON);
+            productions.emplace_back(symbols.nonTerminal(tables.lhs[p]), rhs, int(p));
+        }
+        
+        const size_t words = tables.setWords;
+        firstSets.assign(N, TerminalSet(T));
+        followSets.assign(N, TerminalSet(T));
+        for (size_t n = 0; n < N; ++n) {
+            std::copy(tables.first + n * words, tables.first + (n + 1) * words, firstSets[n].data());
+            std::copy(tables.follow + n * words, tables.follow + (n + 1) * words, followSets[n].data());
+            if (tables.nullable[n]) firstSets[n].setNullable();
+        }
+    });
+}
+
+const SymbolTable& CompiledGrammar::getSymbolTable() const {
+    buildDetails();
+    return symbols;
+}
+
+const std::vector<Production>& CompiledGrammar::getProductions() const {
+    buildDetails();
+    return productions;
+}
+
+const TerminalSet& CompiledGrammar::first(SymbolId nonTerminal) const {
+    buildDetails();
+    return firstSets[nonTerminal];
+}
+
+const TerminalSet& CompiledGrammar::follow(SymbolId nonTerminal) const {
+    buildDetails();
+    return followSets[nonTerminal];
+}
+
+} // namespace LL1
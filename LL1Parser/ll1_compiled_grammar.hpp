@@ -0,0 +1,119 @@
+#pragma once
+
+#include "ll1_grammar.hpp"
+
+namespace LL1 {
+
+// Vista plana y sin dueño de las tablas de una gramática compilada. La producen la
+// caché binaria (secciones del archivo mapeado), los encabezados que genera
+// generate_tables (arrays constexpr) y compile() (su propia imagen en memoria);
+// CompiledGrammar apunta a ellas sin copiarlas.
+struct GrammarTables {
+    std::uint64_t grammarHash;
+    std::uint32_t terminalCount;            // incluye '$' (ID 0)
+    std::uint32_t nonTerminalCount;
+    std::uint32_t productionCount;
+    std::uint32_t rhsCodeCount;
+    std::uint32_t setWords;                 // palabras uint64 por conjunto FIRST/FOLLOW
+    std::uint32_t maxRhsLength;
+    SymbolId startCode;
+    bool ll1;
+    const char* names;                      // nombres terminados en '\0': terminales desde
+                                            // el ID 1 y después no terminales
+    std::uint32_t namesSize;                // bytes de names, con los '\0'
+    const std::uint32_t* nameOffsets;       // terminalCount - 1 + nonTerminalCount posiciones en names
+    const SymbolId* lhs;                    // productionCount IDs de no terminal
+    const std::uint32_t* rhsStart;          // productionCount + 1 posiciones en rhsCodes
+    const SymbolId* rhsCodes;               // rhsCodeCount códigos de símbolo
+    const SymbolId* reversedRhsCodes;       // los mismos, cada lado derecho invertido
+    const std::uint16_t* table;             // nonTerminalCount × terminalCount celdas
+    const std::uint64_t* first;             // setWords palabras por no terminal
+    const std::uint64_t* follow;            // setWords palabras por no terminal
+    const std::uint8_t* nullable;           // 1 si ε ∈ FIRST, por no terminal
+};
+
+class MappedFile;
+
+// Gramática LL(1) compilada e inmutable: producciones aplanadas y tabla densa.
+// Se construye una sola vez a partir de una Grammar y se comparte entre parsers
+// (y entre hilos) mediante std::shared_ptr<const CompiledGrammar>.
+//
+// Lo que usa el análisis (tabla, lados derechos, nombres) son punteros a las tablas
+// del origen, que siguen vivas mientras la gramática: la imagen que construye
+// compile(), el archivo mapeado de la caché o los arrays del encabezado generado. La
+// tabla de símbolos, las producciones con Symbol y los conjuntos como TerminalSet solo
+// hacen falta para diagnósticos, herramientas y tests, y se construyen la primera vez
+// que se piden.
+class CompiledGrammar {
+private:
+    GrammarTables tables = {};
+    std::vector<std::uint64_t> image;       // dueña de `tables` si viene de compile()
+    std::unique_ptr<MappedFile> mapping;    // dueño de `tables` si viene de load()
+    
+    mutable OnceFlag detailsOnce;
+    mutable SymbolTable symbols;
+    mutable std::vector<Production> productions;
+    mutable std::vector<TerminalSet> firstSets;
+    mutable std::vector<TerminalSet> followSets;
+    
+    CompiledGrammar();
+    const char* name(size_t index) const { return tables.names + tables.nameOffsets[index]; }
+    void buildDetails() const;
+
+public:
+    ~CompiledGrammar();
+    
+    // Analiza la gramática (FIRST, FOLLOW, tabla) y congela el resultado
+    static std::shared_ptr<const CompiledGrammar> compile(Grammar grammar);
+    
+    // Igual que compile(), pero reutiliza la caché binaria en cachePath si corresponde
+    // al mismo contenido de gramática; si no, compila y reescribe la caché
+    static std::shared_ptr<const CompiledGrammar> compileCached(Grammar grammar, const std::string& cachePath);
+    
+    // Caché binaria versionada (ver ll1_compiled_grammar.cpp para el formato). load()
+    // mapea el archivo y lo mantiene abierto; devuelve nullptr si falta, está corrupto
+    // o su hash no coincide.
+    static std::shared_ptr<const CompiledGrammar> load(const std::string& path, std::uint64_t expectedHash);
+    bool save(const std::string& path) const;
+    
+    // Gramática sobre tablas ya calculadas que viven al menos tanto como ella (las de un
+    // encabezado generado), sin ningún análisis ni copia. Devuelve nullptr si son
+    // inconsistentes (IDs o rangos fuera de límites).
+    static std::shared_ptr<const CompiledGrammar> fromTables(const GrammarTables& tables);
+    
+    SymbolId getStartCode() const { return tables.startCode; }
+    bool isLL1() const { return tables.ll1; }
+    std::uint64_t getGrammarHash() const { return tables.grammarHash; }
+    size_t terminalCount() const { return tables.terminalCount; }
+    size_t nonTerminalCount() const { return tables.nonTerminalCount; }
+    size_t productionCount() const { return tables.productionCount; }
+    
+    // ID de un símbolo por nombre, sin construir la tabla de símbolos; INVALID_SYMBOL_ID
+    // si no existe
+    SymbolId findSymbol(SymbolType type, std::string_view symbolName) const;
+    
+    // Para diagnósticos (se construyen la primera vez)
+    const SymbolTable& getSymbolTable() const;
+    const std::vector<Production>& getProductions() const;
+    const TerminalSet& first(SymbolId nonTerminal) const;
+    const TerminalSet& follow(SymbolId nonTerminal) const;
+    
+    // Producción para [no terminal, terminal] por ID; -1 si no hay regla
+    int predict(SymbolId nonTerminal, SymbolId terminal) const {
+        if (terminal >= tables.terminalCount) return -1;
+        std::uint16_t cell = tables.table[size_t(nonTerminal) * tables.terminalCount + terminal];
+        return cell == DenseParseTable::NO_PRODUCTION ? -1 : cell;
+    }
+    
+    SymbolId lhs(int production) const { return tables.lhs[production]; }
+    const SymbolId* rhsBegin(int production) const { return tables.rhsCodes + tables.rhsStart[production]; }
+    const SymbolId* rhsEnd(int production) const { return tables.rhsCodes + tables.rhsStart[production + 1]; }
+    size_t rhsLength(int production) const { return tables.rhsStart[production + 1] - tables.rhsStart[production]; }
+    
+    // Los mismos lados derechos, invertidos: el parser los apila con una sola copia
+    const SymbolId* reversedRhsBegin(int production) const { return tables.reversedRhsCodes + tables.rhsStart[production]; }
+    const SymbolId* reversedRhsEnd(int production) const { return tables.reversedRhsCodes + tables.rhsStart[production + 1]; }
+    size_t maxRhsLength() const { return tables.maxRhsLength; }
+};
+
+} // namespace LL1
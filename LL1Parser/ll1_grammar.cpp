@@ -1,251 +1,426 @@
 #include "ll1_grammar.hpp"
 #include <algorithm>
 #include <iomanip>
+#include <stdexcept>
+#include <cstdint>
 
 namespace LL1 {
 
 // Símbolos especiales
 const Symbol EPSILON(SymbolType::EPSILON, "ε");
-const Symbol END_OF_INPUT(SymbolType::END_OF_INPUT, "$");
+const Symbol END_OF_INPUT(SymbolType::END_OF_INPUT, "$", END_OF_INPUT_ID);
 
-void Grammar::computeFirstSets() {
-    if (firstSetsComputed) return;
+// Implementación de SymbolTable
+SymbolTable::SymbolTable() {
+    // '$' ocupa siempre el ID 0 del espacio de terminales
+    terminalNames.push_back("$");
+    terminalIds["$"] = END_OF_INPUT_ID;
+}
+
+SymbolId SymbolTable::intern(const Symbol& symbol) {
+    if (symbol.isEpsilon()) return INVALID_SYMBOL_ID;
+    if (symbol.isEndOfInput()) return END_OF_INPUT_ID;
     
-    firstSets.clear();
+    auto& names = symbol.isNonTerminal() ? nonTerminalNames : terminalNames;
+    auto& ids = symbol.isNonTerminal() ? nonTerminalIds : terminalIds;
     
-    // Inicializar conjuntos FIRST para todos los símbolos
-    for (const auto& terminal : terminals) {
-        firstSets[terminal].insert(terminal);
-    }
+    auto it = ids.find(symbol.name);
+    if (it != ids.end()) return it->second;
     
-    for (const auto& nonTerminal : nonTerminals) {
-        firstSets[nonTerminal] = std::set<Symbol>();
+    if (names.size() >= NON_TERMINAL_FLAG) {
+        throw std::length_error("Too many grammar symbols: " + symbol.name);
     }
     
-    // Algoritmo iterativo para calcular FIRST
-    bool changed = true;
-    while (changed) {
-        changed = false;
+    SymbolId id = static_cast<SymbolId>(names.size());
+    names.push_back(symbol.name);
+    ids.emplace(symbol.name, id);
+    return id;
+}
+
+SymbolId SymbolTable::find(SymbolType type, const std::string& name) const {
+    if (type == SymbolType::END_OF_INPUT) return END_OF_INPUT_ID;
+    if (type == SymbolType::EPSILON) return INVALID_SYMBOL_ID;
+    
+    const auto& ids = (type == SymbolType::NON_TERMINAL) ? nonTerminalIds : terminalIds;
+    auto it = ids.find(name);
+    return it != ids.end() ? it->second : INVALID_SYMBOL_ID;
+}
+
+void Grammar::firstOfSequence(const std::vector<Symbol>& alpha, size_t from, TerminalSet& out) const {
+    for (size_t i = from; i < alpha.size(); ++i) {
+        const Symbol& Xi = alpha[i];
+        
+        // ε no aporta terminales y es anulable
+        if (Xi.isEpsilon()) continue;
+        
+        SymbolId id = Xi.id != INVALID_SYMBOL_ID ? Xi.id : symbolTable.find(Xi.type, Xi.name);
         
-        for (const auto& production : productions) {
-            const Symbol& A = production.lhs;
-            const std::vector<Symbol>& alpha = production.rhs;
+        if (Xi.isNonTerminal()) {
+            // Un no terminal desconocido tiene FIRST vacío y no es anulable
+            if (id == INVALID_SYMBOL_ID) return;
             
-            // Si A -> ε, agregar ε a FIRST(A)
-            if (production.isEpsilonProduction()) {
-                if (firstSets[A].find(EPSILON) == firstSets[A].end()) {
-                    firstSets[A].insert(EPSILON);
-                    changed = true;
-                }
-                continue;
-            }
+            // Agregar FIRST(Xi) - {ε}
+            const TerminalSet& firstXi = firstBits[id];
+            out.unionWith(firstXi);
             
-            // Para A -> X1 X2 ... Xk
-            for (size_t i = 0; i < alpha.size(); ++i) {
-                const Symbol& Xi = alpha[i];
-                
-                // Agregar FIRST(Xi) - {ε} a FIRST(A)
-                for (const auto& symbol : firstSets[Xi]) {
-                    if (!symbol.isEpsilon() && firstSets[A].find(symbol) == firstSets[A].end()) {
-                        firstSets[A].insert(symbol);
-                        changed = true;
-                    }
-                }
-                
-                // Si ε no está en FIRST(Xi), salir del bucle
-                if (firstSets[Xi].find(EPSILON) == firstSets[Xi].end()) {
-                    break;
-                }
-                
-                // Si llegamos al final y todos los Xi derivan ε
-                if (i == alpha.size() - 1) {
-                    if (firstSets[A].find(EPSILON) == firstSets[A].end()) {
-                        firstSets[A].insert(EPSILON);
-                        changed = true;
-                    }
-                }
-            }
+            // Si ε no está en FIRST(Xi), terminar
+            if (!firstXi.isNullable()) return;
+        } else {
+            // FIRST de un terminal es el propio terminal
+            if (id != INVALID_SYMBOL_ID) out.insert(id);
+            return;
         }
     }
     
-    firstSetsComputed = true;
+    // Todos los símbolos derivan ε
+    out.setNullable();
 }
 
-std::set<Symbol> Grammar::first(const std::vector<Symbol>& alpha) {
-    if (!firstSetsComputed) {
-        computeFirstSets();
-    }
-    
+std::set<Symbol> Grammar::toSymbolSet(const TerminalSet& bits) const {
     std::set<Symbol> result;
+    bits.forEach([&](SymbolId t) { result.insert(symbolTable.terminal(t)); });
+    if (bits.isNullable()) result.insert(EPSILON);
+    return result;
+}
+
+// Algoritmo Digraph (DeRemer y Pennello): F(x) = F'(x) ∪ ⋃{ F(y) | x R y }.
+// Un recorrido en profundidad colapsa cada componente fuertemente conexa de R,
+// de modo que cada conjunto se resuelve en una sola pasada topológica.
+namespace {
+
+struct DigraphSolver {
+    const std::vector<std::vector<SymbolId>>& relation;
+    std::vector<TerminalSet>& sets;
+    std::vector<size_t> depth;
+    std::vector<SymbolId> stack;
     
-    if (alpha.empty()) {
-        result.insert(EPSILON);
-        return result;
-    }
+    DigraphSolver(const std::vector<std::vector<SymbolId>>& r, std::vector<TerminalSet>& f)
+        : relation(r), sets(f), depth(f.size(), 0) {}
     
-    // Si es una producción épsilon explícita (un solo símbolo épsilon)
-    if (alpha.size() == 1 && alpha[0].isEpsilon()) {
-        result.insert(EPSILON);
-        return result;
+    void solve() {
+        for (size_t x = 0; x < sets.size(); ++x) {
+            if (depth[x] == 0) traverse(static_cast<SymbolId>(x));
+        }
     }
     
-    for (size_t i = 0; i < alpha.size(); ++i) {
-        const Symbol& Xi = alpha[i];
+    void traverse(SymbolId x) {
+        stack.push_back(x);
+        const size_t d = stack.size();
+        depth[x] = d;
         
-        // Agregar FIRST(Xi) - {ε} al resultado
-        for (const auto& symbol : firstSets[Xi]) {
-            if (!symbol.isEpsilon()) {
-                result.insert(symbol);
-            }
+        for (SymbolId y : relation[x]) {
+            if (depth[y] == 0) traverse(y);
+            depth[x] = std::min(depth[x], depth[y]);
+            sets[x].unionWith(sets[y]);
         }
         
-        // Si ε no está en FIRST(Xi), terminar
-        if (firstSets[Xi].find(EPSILON) == firstSets[Xi].end()) {
-            break;
+        // x es la raíz de su componente: todos sus miembros comparten el conjunto
+        if (depth[x] == d) {
+            while (true) {
+                SymbolId top = stack.back();
+                stack.pop_back();
+                depth[top] = SIZE_MAX;
+                if (top == x) break;
+                sets[top].unionWith(sets[x]);
+            }
+        }
+    }
+};
+
+} // namespace
+
+void Grammar::computeFirstSets() {
+    firstSetsOnce.run([this] { computeFirstSetsInternal(); });
+}
+
+void Grammar::computeFirstSetsInternal() {
+    const size_t terminalCount = symbolTable.terminalCount();
+    const size_t nonTerminalCount = symbolTable.nonTerminalCount();
+    
+    // 1. No terminales anulables, por propagación lineal sobre las producciones
+    std::vector<bool> nullable(nonTerminalCount, false);
+    std::vector<size_t> pending(productions.size(), 0);       // símbolos aún no anulables por producción
+    std::vector<std::vector<size_t>> occurrences(nonTerminalCount);
+    std::vector<SymbolId> worklist;
+    
+    for (const auto& production : productions) {
+        for (const auto& Xi : production.rhs) {
+            if (Xi.isEpsilon()) continue;
+            if (Xi.isNonTerminal()) {
+                occurrences[Xi.id].push_back(production.id);
+                ++pending[production.id];
+            } else {
+                pending[production.id] = SIZE_MAX;   // un terminal nunca deriva ε
+                break;
+            }
         }
+        if (pending[production.id] == 0 && !nullable[production.lhs.id]) {
+            nullable[production.lhs.id] = true;
+            worklist.push_back(production.lhs.id);
+        }
+    }
+    
+    while (!worklist.empty()) {
+        SymbolId B = worklist.back();
+        worklist.pop_back();
+        for (size_t p : occurrences[B]) {
+            if (pending[p] == SIZE_MAX || --pending[p] != 0) continue;
+            SymbolId A = productions[p].lhs.id;
+            if (!nullable[A]) {
+                nullable[A] = true;
+                worklist.push_back(A);
+            }
+        }
+    }
+    
+    // 2. FIRST'(A) = terminales visibles directamente; A R B si A -> α B ... con α anulable
+    firstBits.assign(nonTerminalCount, TerminalSet(terminalCount));
+    std::vector<std::vector<SymbolId>> dependsOn(nonTerminalCount);
+    
+    for (const auto& production : productions) {
+        const SymbolId A = production.lhs.id;
+        for (const auto& Xi : production.rhs) {
+            if (Xi.isEpsilon()) continue;
+            if (!Xi.isNonTerminal()) {
+                firstBits[A].insert(Xi.id);
+                break;
+            }
+            dependsOn[A].push_back(Xi.id);
+            if (!nullable[Xi.id]) break;
+        }
+    }
+    
+    // 3. Resolver el grafo de dependencias
+    DigraphSolver(dependsOn, firstBits).solve();
+    
+    for (size_t A = 0; A < nonTerminalCount; ++A) {
+        if (nullable[A]) firstBits[A].setNullable();
+    }
+    
+    // 4. FIRST y anulabilidad de cada sufijo de cada lado derecho, reutilizados
+    //    por FOLLOW y por la tabla: el sufijo i de la producción p es rhs[i..]
+    suffixStart.assign(productions.size() + 1, 0);
+    for (size_t p = 0; p < productions.size(); ++p) {
+        suffixStart[p + 1] = suffixStart[p] + productions[p].rhs.size() + 1;
+    }
+    suffixFirst.assign(suffixStart.back(), TerminalSet(terminalCount));
+    
+    for (const auto& production : productions) {
+        const std::vector<Symbol>& alpha = production.rhs;
+        TerminalSet* suffix = &suffixFirst[suffixStart[production.id]];
+        suffix[alpha.size()].setNullable();
         
-        // Si llegamos al final y todos derivan ε
-        if (i == alpha.size() - 1) {
-            result.insert(EPSILON);
+        for (size_t i = alpha.size(); i-- > 0;) {
+            const Symbol& Xi = alpha[i];
+            if (Xi.isEpsilon()) {
+                suffix[i] = suffix[i + 1];
+            } else if (!Xi.isNonTerminal()) {
+                suffix[i].insert(Xi.id);
+            } else {
+                suffix[i].unionWith(firstBits[Xi.id]);
+                if (nullable[Xi.id]) {
+                    suffix[i].unionWith(suffix[i + 1]);
+                    if (suffix[i + 1].isNullable()) suffix[i].setNullable();
+                }
+            }
         }
     }
     
-    return result;
+    // Exponer los conjuntos con Symbol
+    firstSets.clear();
+    for (const auto& terminal : terminals) {
+        firstSets[terminal].insert(terminal);
+    }
+    for (const auto& nonTerminal : nonTerminals) {
+        firstSets[nonTerminal] = toSymbolSet(firstBits[nonTerminal.id]);
+    }
+}
+
+std::set<Symbol> Grammar::first(const std::vector<Symbol>& alpha) {
+    computeFirstSets();
+    
+    TerminalSet result(symbolTable.terminalCount());
+    firstOfSequence(alpha, 0, result);
+    return toSymbolSet(result);
 }
 
 const std::map<Symbol, std::set<Symbol>>& Grammar::getFirstSets() {
-    if (!firstSetsComputed) {
-        computeFirstSets();
-    }
+    computeFirstSets();
     return firstSets;
 }
 
 void Grammar::computeFollowSets() {
-    if (followSetsComputed) return;
-    if (!firstSetsComputed) {
-        computeFirstSets();
-    }
+    followSetsOnce.run([this] { computeFollowSetsInternal(); });
+}
+
+void Grammar::computeFollowSetsInternal() {
+    computeFirstSets();
     
-    followSets.clear();
+    const size_t terminalCount = symbolTable.terminalCount();
+    const size_t nonTerminalCount = symbolTable.nonTerminalCount();
     
-    // Inicializar conjuntos FOLLOW
-    for (const auto& nonTerminal : nonTerminals) {
-        followSets[nonTerminal] = std::set<Symbol>();
-    }
+    // FOLLOW'(B) = FIRST(β) - {ε} para cada A -> α B β; B R A si β es anulable
+    followBits.assign(nonTerminalCount, TerminalSet(terminalCount));
+    std::vector<std::vector<SymbolId>> includes(nonTerminalCount);
     
     // FOLLOW(S) contiene $
-    followSets[startSymbol].insert(END_OF_INPUT);
+    followBits[startSymbol.id].insert(END_OF_INPUT_ID);
     
-    // Algoritmo iterativo para calcular FOLLOW
-    bool changed = true;
-    while (changed) {
-        changed = false;
+    for (const auto& production : productions) {
+        const std::vector<Symbol>& beta = production.rhs;
         
-        for (const auto& production : productions) {
-            const std::vector<Symbol>& beta = production.rhs;
+        for (size_t i = 0; i < beta.size(); ++i) {
+            const Symbol& B = beta[i];
+            if (!B.isNonTerminal()) continue;
             
-            // Para cada símbolo en el lado derecho
-            for (size_t i = 0; i < beta.size(); ++i) {
-                const Symbol& B = beta[i];
-                
-                if (!B.isNonTerminal()) continue;
-                
-                // Obtener β (resto de la producción después de B)
-                std::vector<Symbol> restBeta(beta.begin() + i + 1, beta.end());
-                
-                // Calcular FIRST(β)
-                std::set<Symbol> firstBeta = first(restBeta);
-                
-                // Agregar FIRST(β) - {ε} a FOLLOW(B)
-                for (const auto& symbol : firstBeta) {
-                    if (!symbol.isEpsilon() && followSets[B].find(symbol) == followSets[B].end()) {
-                        followSets[B].insert(symbol);
-                        changed = true;
-                    }
-                }
-                
-                // Si ε ∈ FIRST(β), agregar FOLLOW(A) a FOLLOW(B)
-                if (firstBeta.find(EPSILON) != firstBeta.end()) {
-                    for (const auto& symbol : followSets[production.lhs]) {
-                        if (followSets[B].find(symbol) == followSets[B].end()) {
-                            followSets[B].insert(symbol);
-                            changed = true;
-                        }
-                    }
-                }
+            // FIRST(β) precalculado para el resto de la producción después de B
+            const TerminalSet& firstBeta = firstOfSuffix(production.id, i + 1);
+            followBits[B.id].unionWith(firstBeta);
+            if (firstBeta.isNullable()) {
+                includes[B.id].push_back(production.lhs.id);
             }
         }
     }
     
-    followSetsComputed = true;
+    DigraphSolver(includes, followBits).solve();
+    
+    // Exponer los conjuntos con Symbol
+    followSets.clear();
+    for (const auto& nonTerminal : nonTerminals) {
+        followSets[nonTerminal] = toSymbolSet(followBits[nonTerminal.id]);
+    }
 }
 
 const std::map<Symbol, std::set<Symbol>>& Grammar::getFollowSets() {
-    if (!followSetsComputed) {
-        computeFollowSets();
-    }
+    computeFollowSets();
     return followSets;
 }
 
 bool Grammar::buildParseTable() {
-    if (parseTableComputed) return true;
+    // Con conflictos la tabla queda parcial y se sigue devolviendo false
+    parseTableOnce.run([this] { parseTableValid = buildParseTableInternal(); });
+    return parseTableValid;
+}
+
+bool Grammar::buildParseTableInternal() {
+    computeFirstSets();
+    computeFollowSets();
+    
+    denseParseTable.reset(symbolTable.nonTerminalCount(), symbolTable.terminalCount());
     
-    if (!firstSetsComputed) computeFirstSets();
-    if (!followSetsComputed) computeFollowSets();
+    if (productions.size() >= DenseParseTable::NO_PRODUCTION) {
+        std::cerr << "Grammar has too many productions for the dense parse table" << std::endl;
+        return false;
+    }
     
-    parseTable.clear();
+    // Terminales en orden de nombre, para reportar los conflictos en el orden de la tabla impresa
+    std::vector<SymbolId> terminalOrder;
+    terminalOrder.reserve(terminals.size());
+    for (const auto& terminal : terminals) {
+        terminalOrder.push_back(terminal.id);
+    }
     
     // Para cada producción A -> α
     for (const auto& production : productions) {
-        const Symbol& A = production.lhs;
-        const std::vector<Symbol>& alpha = production.rhs;
+        const SymbolId A = production.lhs.id;
+        const auto cell = static_cast<std::uint16_t>(production.id);
         
-        // Calcular FIRST(α)
-        std::set<Symbol> firstAlpha = first(alpha);
+        // FIRST(α) precalculado
+        const TerminalSet& firstAlpha = firstOfSuffix(production.id, 0);
         
         // Para cada terminal a en FIRST(α)
-        for (const auto& a : firstAlpha) {
-            if (a.isTerminal()) {
-                auto key = std::make_pair(A, a);
-                if (parseTable.find(key) != parseTable.end()) {
-                    // Conflicto: la gramática no es LL(1)
-                    std::cerr << "Grammar is not LL(1): conflict at [" << A.name 
-                              << ", " << a.name << "]" << std::endl;
-                    return false;
-                }
-                parseTable[key] = production.id;
+        for (SymbolId a : terminalOrder) {
+            if (!firstAlpha.contains(a)) continue;
+            if (denseParseTable.at(A, a) != DenseParseTable::NO_PRODUCTION) {
+                // Conflicto: la gramática no es LL(1)
+                std::cerr << "Grammar is not LL(1): conflict at [" << symbolTable.nonTerminalName(A)
+                          << ", " << symbolTable.terminalName(a) << "]" << std::endl;
+                return false;
             }
+            denseParseTable.at(A, a) = cell;
         }
         
         // Si ε ∈ FIRST(α)
-        if (firstAlpha.find(EPSILON) != firstAlpha.end()) {
-            // Para cada terminal b en FOLLOW(A)
-            for (const auto& b : followSets[A]) {
-                if (b.isTerminal() || b.isEndOfInput()) {
-                    auto key = std::make_pair(A, b);
-                    if (parseTable.find(key) != parseTable.end()) {
-                        // Conflicto: la gramática no es LL(1)
-                        std::cerr << "Grammar is not LL(1): conflict at [" << A.name 
-                                  << ", " << b.name << "] - production " << production.id << std::endl;
-                        return false;
-                    }
-                    parseTable[key] = production.id;
+        if (firstAlpha.isNullable()) {
+            // Para cada terminal b en FOLLOW(A), con '$' al final
+            const TerminalSet& followA = followBits[A];
+            for (size_t k = 0; k <= terminalOrder.size(); ++k) {
+                SymbolId b = k < terminalOrder.size() ? terminalOrder[k] : END_OF_INPUT_ID;
+                if (!followA.contains(b)) continue;
+                if (denseParseTable.at(A, b) != DenseParseTable::NO_PRODUCTION) {
+                    // Conflicto: la gramática no es LL(1)
+                    std::cerr << "Grammar is not LL(1): conflict at [" << symbolTable.nonTerminalName(A)
+                              << ", " << symbolTable.terminalName(b) << "] - production " << production.id << std::endl;
+                    return false;
                 }
+                denseParseTable.at(A, b) = cell;
             }
         }
     }
     
-    parseTableComputed = true;
     return true;
 }
 
 const std::map<std::pair<Symbol, Symbol>, int>& Grammar::getParseTable() {
-    if (!parseTableComputed) {
-        buildParseTable();
-    }
+    buildParseTable();
+    
+    // La tabla con Symbol se materializa bajo demanda desde la tabla densa
+    parseTableMapOnce.run([this] {
+        parseTable.clear();
+        for (size_t A = 0; A < denseParseTable.rows; ++A) {
+            for (size_t t = 0; t < denseParseTable.columns; ++t) {
+                int production = denseParseTable.lookup(SymbolId(A), SymbolId(t));
+                if (production >= 0) {
+                    parseTable[{symbolTable.nonTerminal(SymbolId(A)), symbolTable.terminal(SymbolId(t))}] = production;
+                }
+            }
+        }
+    });
     return parseTable;
 }
 
+const DenseParseTable& Grammar::getDenseParseTable() {
+    buildParseTable();
+    return denseParseTable;
+}
+
+const std::vector<TerminalSet>& Grammar::getFirstBits() {
+    computeFirstSets();
+    return firstBits;
+}
+
+const std::vector<TerminalSet>& Grammar::getFollowBits() {
+    computeFollowSets();
+    return followBits;
+}
+
+std::uint64_t Grammar::contentHash() const {
+    std::uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+    auto mixSymbol = [&mix](const Symbol& symbol) {
+        unsigned char type = static_cast<unsigned char>(symbol.type);
+        mix(&type, 1);
+        mix(symbol.name.c_str(), symbol.name.size() + 1);
+    };
+    
+    mixSymbol(startSymbol);
+    for (const auto& production : productions) {
+        mixSymbol(production.lhs);
+        std::uint32_t length = static_cast<std::uint32_t>(production.rhs.size());
+        mix(&length, sizeof(length));
+        for (const auto& symbol : production.rhs) {
+            mixSymbol(symbol);
+        }
+    }
+    return hash;
+}
+
 bool Grammar::isLL1() {
     return buildParseTable();
 }
@@ -263,7 +438,7 @@ void Grammar::printGrammar() const {
 }
 
 void Grammar::printFirstSets() {
-    if (!firstSetsComputed) computeFirstSets();
+    computeFirstSets();
     
     std::cout << "FIRST Sets:" << std::endl;
     std::cout << "===========" << std::endl;
@@ -282,7 +457,7 @@ void Grammar::printFirstSets() {
 }
 
 void Grammar::printFollowSets() {
-    if (!followSetsComputed) computeFollowSets();
+    computeFollowSets();
     
     std::cout << "FOLLOW Sets:" << std::endl;
     std::cout << "============" << std::endl;
@@ -301,7 +476,7 @@ void Grammar::printFollowSets() {
 }
 
 void Grammar::printParseTable() {
-    if (!parseTableComputed) buildParseTable();
+    getParseTable(); // construye la tabla y su versión con Symbol si hace falta
     
     std::cout << "LL(1) Parse Table:" << std::endl;
     std::cout << "==================" << std::endl;
@@ -8,9 +8,20 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <memory>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 
 namespace LL1 {
 
+// Identificador compacto de símbolo, asignado por la tabla de símbolos de la gramática.
+// Terminales y no terminales tienen espacios de IDs independientes y densos.
+using SymbolId = std::uint16_t;
+constexpr SymbolId INVALID_SYMBOL_ID = 0xFFFF;
+constexpr SymbolId END_OF_INPUT_ID = 0;          // '$' siempre es el terminal 0
+constexpr SymbolId NON_TERMINAL_FLAG = 0x8000;   // marca no terminales en la pila del parser
+
 // Símbolos de la gramática
 enum class SymbolType {
     TERMINAL,
@@ -21,10 +32,12 @@ enum class SymbolType {
 
 struct Symbol {
     SymbolType type;
-    std::string name;
+    std::string name;             // solo para diagnósticos e impresión
+    SymbolId id = INVALID_SYMBOL_ID;
     
     Symbol() = default;
-    Symbol(SymbolType t, const std::string& n) : type(t), name(n) {}
+    Symbol(SymbolType t, const std::string& n, SymbolId symbolId = INVALID_SYMBOL_ID)
+        : type(t), name(n), id(symbolId) {}
     
     bool operator==(const Symbol& other) const {
         return type == other.type && name == other.name;
@@ -39,6 +52,44 @@ struct Symbol {
     bool isNonTerminal() const { return type == SymbolType::NON_TERMINAL; }
     bool isEpsilon() const { return type == SymbolType::EPSILON; }
     bool isEndOfInput() const { return type == SymbolType::END_OF_INPUT; }
+    
+    // Código para la pila del parser: ID del símbolo con NON_TERMINAL_FLAG en no terminales
+    SymbolId code() const { return isNonTerminal() ? SymbolId(id | NON_TERMINAL_FLAG) : id; }
+};
+
+// Tabla de símbolos: asigna IDs densos a terminales y no terminales
+class SymbolTable {
+private:
+    std::vector<std::string> terminalNames;
+    std::vector<std::string> nonTerminalNames;
+    std::unordered_map<std::string, SymbolId> terminalIds;
+    std::unordered_map<std::string, SymbolId> nonTerminalIds;
+
+public:
+    SymbolTable();
+    
+    // Devuelve el ID del símbolo, registrándolo si es nuevo (ε no tiene ID)
+    SymbolId intern(const Symbol& symbol);
+    
+    // Busca un símbolo ya registrado; INVALID_SYMBOL_ID si no existe
+    SymbolId find(SymbolType type, const std::string& name) const;
+    
+    // Reconstruye el Symbol de un ID (para exponer resultados en la API basada en Symbol)
+    Symbol terminal(SymbolId id) const {
+        return id == END_OF_INPUT_ID ? Symbol(SymbolType::END_OF_INPUT, terminalNames[id], id)
+                                     : Symbol(SymbolType::TERMINAL, terminalNames[id], id);
+    }
+    Symbol nonTerminal(SymbolId id) const { return Symbol(SymbolType::NON_TERMINAL, nonTerminalNames[id], id); }
+    
+    const std::string& terminalName(SymbolId id) const { return terminalNames[id]; }
+    const std::string& nonTerminalName(SymbolId id) const { return nonTerminalNames[id]; }
+    const std::string& nameOf(SymbolId code) const {
+        return (code & NON_TERMINAL_FLAG) ? nonTerminalNames[code & ~NON_TERMINAL_FLAG] : terminalNames[code];
+    }
+    
+    // Número de terminales (incluye '$') y de no terminales
+    size_t terminalCount() const { return terminalNames.size(); }
+    size_t nonTerminalCount() const { return nonTerminalNames.size(); }
 };
 
 // Producción de la gramática: A -> α
@@ -68,24 +119,173 @@ struct Production {
     }
 };
 
-// Gramática LL(1)
+// Conjunto de terminales como bitset de ancho fijo sobre IDs de terminal, más un
+// bit aparte para ε. Las uniones son OR palabra a palabra y detectan cambios por XOR.
+class TerminalSet {
+private:
+    std::vector<std::uint64_t> words;
+    bool nullable = false;
+
+public:
+    TerminalSet() = default;
+    explicit TerminalSet(size_t terminalCount) : words((terminalCount + 63) / 64, 0) {}
+    
+    // Agrega un terminal; devuelve true si no estaba
+    bool insert(SymbolId terminal) {
+        std::uint64_t& word = words[terminal >> 6];
+        std::uint64_t bit = std::uint64_t(1) << (terminal & 63);
+        bool added = !(word & bit);
+        word |= bit;
+        return added;
+    }
+    
+    bool contains(SymbolId terminal) const {
+        return (words[terminal >> 6] >> (terminal & 63)) & 1;
+    }
+    
+    bool isNullable() const { return nullable; }
+    
+    // Marca ε; devuelve true si no estaba
+    bool setNullable() {
+        bool added = !nullable;
+        nullable = true;
+        return added;
+    }
+    
+    // this |= other (sin ε); devuelve true si cambió algún bit
+    bool unionWith(const TerminalSet& other) {
+        std::uint64_t changed = 0;
+        for (size_t i = 0; i < words.size(); ++i) {
+            std::uint64_t merged = words[i] | other.words[i];
+            changed |= merged ^ words[i];
+            words[i] = merged;
+        }
+        return changed != 0;
+    }
+    
+    void clear() {
+        std::fill(words.begin(), words.end(), 0);
+        nullable = false;
+    }
+    
+    // Acceso a las palabras del bitset (serialización)
+    std::uint64_t* data() { return words.data(); }
+    const std::uint64_t* data() const { return words.data(); }
+    size_t wordCount() const { return words.size(); }
+    
+    // Número de terminales en el conjunto (sin contar ε)
+    size_t count() const {
+        size_t total = 0;
+        for (std::uint64_t word : words) total += __builtin_popcountll(word);
+        return total;
+    }
+    
+    // Recorre los IDs de terminal presentes en orden creciente
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (size_t i = 0; i < words.size(); ++i) {
+            std::uint64_t word = words[i];
+            while (word) {
+                fn(static_cast<SymbolId>(i * 64 + __builtin_ctzll(word)));
+                word &= word - 1;
+            }
+        }
+    }
+};
+
+// Tabla LL(1) compilada: una fila por no terminal y una columna por terminal
+// ('$' en la columna 0). Cada celda guarda el índice de producción o NO_PRODUCTION.
+struct DenseParseTable {
+    static constexpr std::uint16_t NO_PRODUCTION = 0xFFFF;
+    
+    size_t rows = 0;
+    size_t columns = 0;
+    std::vector<std::uint16_t> cells;
+    
+    void reset(size_t nonTerminalCount, size_t terminalCount) {
+        rows = nonTerminalCount;
+        columns = terminalCount;
+        cells.assign(rows * columns, NO_PRODUCTION);
+    }
+    
+    std::uint16_t& at(SymbolId nonTerminal, SymbolId terminal) {
+        return cells[size_t(nonTerminal) * columns + terminal];
+    }
+    
+    // Producción para [no terminal, terminal]; -1 si es una celda de error
+    int lookup(SymbolId nonTerminal, SymbolId terminal) const {
+        if (terminal >= columns) return -1;
+        std::uint16_t cell = cells[size_t(nonTerminal) * columns + terminal];
+        return cell == NO_PRODUCTION ? -1 : cell;
+    }
+};
+
+// Inicialización perezosa segura entre hilos. El camino rápido es una carga con
+// acquire; la primera ejecución se serializa con un mutex y se publica con release.
+// Copiar la bandera copia el estado, no el mutex.
+class OnceFlag {
+private:
+    std::atomic<bool> done{false};
+    std::mutex mutex;
+
+public:
+    OnceFlag() = default;
+    OnceFlag(const OnceFlag& other) : done(other.isDone()) {}
+    OnceFlag& operator=(const OnceFlag& other) {
+        done.store(other.isDone(), std::memory_order_release);
+        return *this;
+    }
+    
+    bool isDone() const { return done.load(std::memory_order_acquire); }
+    
+    template <typename Fn>
+    void run(Fn fn) {
+        if (isDone()) return;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (done.load(std::memory_order_relaxed)) return;
+        fn();
+        done.store(true, std::memory_order_release);
+    }
+    
+    // Solo desde el hilo que modifica la gramática, sin lectores concurrentes
+    void reset() { done.store(false, std::memory_order_relaxed); }
+};
+
+// Gramática LL(1).
+// Los cálculos perezosos (FIRST, FOLLOW, tabla) son seguros con varios hilos leyendo
+// la misma gramática; agregar producciones o copiarla no lo es.
 class Grammar {
 private:
     std::vector<Production> productions;
     std::set<Symbol> terminals;
     std::set<Symbol> nonTerminals;
     Symbol startSymbol;
+    SymbolTable symbolTable;
     
-    // Conjuntos FIRST y FOLLOW para análisis LL(1)
+    // Conjuntos FIRST y FOLLOW para análisis LL(1), indexados por ID de no terminal
+    std::vector<TerminalSet> firstBits;
+    std::vector<TerminalSet> followBits;
+    
+    // FIRST de cada sufijo de lado derecho: el sufijo i de la producción p está en
+    // suffixFirst[suffixStart[p] + i], para i = 0..|rhs| (el último es el sufijo vacío)
+    std::vector<TerminalSet> suffixFirst;
+    std::vector<size_t> suffixStart;
+    
+    // Mismos conjuntos expuestos con Symbol, para impresión y la API pública
     std::map<Symbol, std::set<Symbol>> firstSets;
     std::map<Symbol, std::set<Symbol>> followSets;
     
     // Tabla de análisis LL(1)
     std::map<std::pair<Symbol, Symbol>, int> parseTable;
     
-    bool firstSetsComputed = false;
-    bool followSetsComputed = false;
-    bool parseTableComputed = false;
+    // Misma tabla compilada en un arreglo denso indexado por IDs
+    DenseParseTable denseParseTable;
+    
+    OnceFlag firstSetsOnce;
+    OnceFlag followSetsOnce;
+    OnceFlag parseTableOnce;
+    OnceFlag parseTableMapOnce;       // versión con Symbol de la tabla, para impresión
+    bool parseTableValid = false;     // false si la gramática tiene conflictos LL(1)
 
 public:
     Grammar() = default;
@@ -93,10 +293,18 @@ public:
     // Agregar producción
     void addProduction(const Symbol& lhs, const std::vector<Symbol>& rhs) {
         productions.emplace_back(lhs, rhs, productions.size());
-        nonTerminals.insert(lhs);
+        Production& production = productions.back();
+        
+        // Internar símbolos: la producción almacenada lleva los IDs asignados
+        production.lhs.id = symbolTable.intern(production.lhs);
+        for (auto& symbol : production.rhs) {
+            symbol.id = symbolTable.intern(symbol);
+        }
+        
+        nonTerminals.insert(production.lhs);
         
         // Agregar símbolos del lado derecho
-        for (const auto& symbol : rhs) {
+        for (const auto& symbol : production.rhs) {
             if (symbol.isTerminal()) {
                 terminals.insert(symbol);
             } else if (symbol.isNonTerminal()) {
@@ -105,14 +313,16 @@ public:
         }
         
         // Resetear cálculos
-        firstSetsComputed = false;
-        followSetsComputed = false;
-        parseTableComputed = false;
+        firstSetsOnce.reset();
+        followSetsOnce.reset();
+        parseTableOnce.reset();
+        parseTableMapOnce.reset();
     }
     
     void setStartSymbol(const Symbol& start) {
         startSymbol = start;
-        nonTerminals.insert(start);
+        startSymbol.id = symbolTable.intern(startSymbol);
+        nonTerminals.insert(startSymbol);
     }
     
     // Getters
@@ -120,19 +330,32 @@ public:
     const std::set<Symbol>& getTerminals() const { return terminals; }
     const std::set<Symbol>& getNonTerminals() const { return nonTerminals; }
     const Symbol& getStartSymbol() const { return startSymbol; }
+    const SymbolTable& getSymbolTable() const { return symbolTable; }
     
     // Métodos para calcular conjuntos FIRST
     void computeFirstSets();
     std::set<Symbol> first(const std::vector<Symbol>& alpha);
     const std::map<Symbol, std::set<Symbol>>& getFirstSets();
+    const std::vector<TerminalSet>& getFirstBits();      // indexado por ID de no terminal
     
     // Métodos para calcular conjuntos FOLLOW
     void computeFollowSets();
     const std::map<Symbol, std::set<Symbol>>& getFollowSets();
+    const std::vector<TerminalSet>& getFollowBits();     // indexado por ID de no terminal
     
     // Construcción de tabla de análisis LL(1)
     bool buildParseTable();
     const std::map<std::pair<Symbol, Symbol>, int>& getParseTable();
+    const DenseParseTable& getDenseParseTable();
+    
+    // Producción a aplicar para [no terminal, terminal] por ID; -1 si no hay regla.
+    // Requiere que la tabla ya esté construida (buildParseTable).
+    int predict(SymbolId nonTerminal, SymbolId terminal) const {
+        return denseParseTable.lookup(nonTerminal, terminal);
+    }
+    
+    // Hash (FNV-1a) del contenido: símbolo inicial y producciones en orden
+    std::uint64_t contentHash() const;
     
     // Verificar si la gramática es LL(1)
     bool isLL1();
@@ -146,6 +369,15 @@ public:
 private:
     void computeFirstSetsInternal();
     void computeFollowSetsInternal();
+    bool buildParseTableInternal();
+    
+    const TerminalSet& firstOfSuffix(size_t production, size_t position) const {
+        return suffixFirst[suffixStart[production] + position];
+    }
+    
+    // Une a 'out' FIRST(alpha[from..]) y marca ε si todo el sufijo es anulable
+    void firstOfSequence(const std::vector<Symbol>& alpha, size_t from, TerminalSet& out) const;
+    std::set<Symbol> toSymbolSet(const TerminalSet& bits) const;
 };
 
 // Símbolos especiales
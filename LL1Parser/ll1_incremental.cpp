@@ -0,0 +1,407 @@
+#include "ll1_incremental.hpp"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace LL1 {
+
+namespace {
+
+// Sustituir los elementos [begin, end) de `to` por los de `from` (que se mueven),
+// moviendo la cola una sola vez
+template <typename T>
+void splice(std::vector<T>& to, size_t begin, size_t end, std::vector<T>& from) {
+    const size_t removed = end - begin;
+    if (from.size() > removed) {
+        to.insert(to.begin() + end, std::make_move_iterator(from.begin() + removed), std::make_move_iterator(from.end()));
+        std::move(from.begin(), from.begin() + removed, to.begin() + begin);
+    } else {
+        to.erase(to.begin() + begin + from.size(), to.begin() + end);
+        std::move(from.begin(), from.end(), to.begin() + begin);
+    }
+}
+
+// Tokens sin el END_OF_INPUT final (que falta tras un error léxico)
+size_t countWithoutEnd(const TokenBuffer& tokens) {
+    const size_t size = tokens.size();
+    return size > 0 && tokens.kind(size - 1) == TokenKind::END_OF_INPUT ? size - 1 : size;
+}
+
+// ¿Es el token i de `a` el j de `b` desplazado `delta` bytes?
+bool sameToken(const TokenBuffer& a, size_t i, const TokenBuffer& b, size_t j, std::ptrdiff_t delta) {
+    return a.kind(i) == b.kind(j) && a.length(i) == b.length(j) &&
+           std::ptrdiff_t(a.offset(i)) == std::ptrdiff_t(b.offset(j)) + delta;
+}
+
+// Sentencia anidada de splitBlocks, en índices absolutos de token, con los interiores
+// de sus bloques directos como pares [primer token, '}' que lo cierra)
+struct BlockStatement {
+    size_t begin;
+    size_t end;
+    std::vector<std::pair<size_t, size_t>> blocks;
+};
+
+// Partir la sentencia del nivel superior [begin, end) en las sentencias de las listas
+// de sus bloques, a cualquier profundidad y con el criterio de endsStatement; la última
+// es la propia sentencia. Devuelve false si las llaves o los paréntesis no cuadran.
+bool splitBlocks(const TokenBuffer& tokens, size_t begin, size_t end, std::vector<BlockStatement>& out) {
+    constexpr size_t NONE = size_t(-1);
+    struct Level {
+        size_t start;                                   // sentencia en curso (NONE: ninguna)
+        size_t open;                                    // '{' del bloque
+        int depth;                                      // paréntesis abiertos
+        std::vector<std::pair<size_t, size_t>> blocks;
+    };
+    std::vector<Level> levels;
+    levels.push_back({begin, NONE, 0, {}});
+    out.clear();
+    
+    // Terminar la sentencia en curso del nivel de arriba en `last` (inclusive)
+    const auto close = [&](size_t last) {
+        Level& level = levels.back();
+        out.push_back({level.start, last + 1, std::move(level.blocks)});
+        level.blocks.clear();
+        level.start = NONE;
+    };
+    for (size_t i = begin; i < end; ++i) {
+        const TokenKind kind = tokens.kind(i);
+        if (levels.back().start == NONE && kind != TokenKind::RBRACE) levels.back().start = i;
+        switch (kind) {
+        case TokenKind::LPAREN:
+            ++levels.back().depth;
+            break;
+        case TokenKind::RPAREN:
+            if (--levels.back().depth < 0) return false;
+            break;
+        case TokenKind::LBRACE:
+            levels.push_back({NONE, i, 0, {}});
+            break;
+        case TokenKind::RBRACE: {
+            if (levels.size() == 1 || levels.back().depth != 0) return false;
+            if (levels.back().start != NONE) close(i - 1);
+            const size_t open = levels.back().open;
+            levels.pop_back();
+            levels.back().blocks.emplace_back(open + 1, i);
+            if (levels.size() > 1 && levels.back().depth == 0 &&
+                !(i + 1 < end && tokens.kind(i + 1) == TokenKind::SEMICOLON)) {
+                close(i);
+            }
+            break;
+        }
+        case TokenKind::SEMICOLON:
+            if (levels.size() > 1 && levels.back().depth == 0) close(i);
+            break;
+        default:
+            break;
+        }
+    }
+    if (levels.size() != 1) return false;
+    out.push_back({begin, end, std::move(levels[0].blocks)});
+    return true;
+}
+
+} // namespace
+
+std::unique_ptr<IncrementalParse> LL1Parser::parseIncremental(std::string_view text, std::string name) const {
+    // El primer análisis es la edición que inserta todo el texto en un documento vacío
+    std::unique_ptr<IncrementalParse> document(new IncrementalParse());
+    document->name = std::move(name);
+    Lexer(document->source).tokenizeAll(document->tokens);
+    document->starts = {0};
+    reparse(*document, TextEdit{0, 0, text});
+    return document;
+}
+
+bool LL1Parser::reparse(IncrementalParse& document, const TextEdit& edit) const {
+    std::string& source = document.source;
+    if (edit.offset > source.size() || edit.removed > source.size() - edit.offset) {
+        throw std::out_of_range("Text edit outside the document");
+    }
+    
+    TokenBuffer& tokens = document.tokens;
+    std::vector<size_t>& starts = document.starts;
+    std::vector<char>& valid = document.valid;
+    std::vector<std::vector<NestedStatement>>& nested = document.nested;
+    const SymbolId startSymbol = grammar->getStartCode() & ~NON_TERMINAL_FLAG;
+    const SymbolId list = statementListCode & ~NON_TERMINAL_FLAG;
+    constexpr size_t NONE = size_t(-1);
+    
+    // Sin la forma de lista de sentencias no se reutiliza nada: se analiza el texto completo
+    const bool reusable = statementListCode != INVALID_SYMBOL_ID;
+    if (!reusable) {
+        source.replace(edit.offset, edit.removed, edit.inserted);
+        Lexer(source).tokenizeAll(tokens);
+        starts = {0};
+        valid.clear();
+        nested.clear();
+        document.relexed = tokens.size();
+        document.reparsed = 0;
+        document.reparsedTokenCount = 0;
+    } else {
+        // Se vuelve a extraer desde el primer token de la sentencia que contiene el último
+        // token anterior a la edición: así ni ese token ni el ';' o '}' que cierra la
+        // sentencia previa (que solo mira un carácter más) pueden crecer con el texto nuevo
+        const size_t oldCount = countWithoutEnd(tokens);
+        const bool oldError = tokens.hasError();
+        const auto offsets = tokens.offsets.begin();
+        size_t firstStatement = 0;
+        const size_t touched = std::lower_bound(offsets, offsets + oldCount, edit.offset) - offsets;
+        if (touched > 0 && !valid.empty()) {
+            firstStatement = std::upper_bound(starts.begin(), starts.end() - 1, touched - 1) - starts.begin() - 1;
+        }
+        const size_t firstToken = starts[firstStatement];
+        const size_t restart = firstStatement == 0 ? 0 : tokens.offset(firstToken);
+        
+        const std::ptrdiff_t delta = std::ptrdiff_t(edit.inserted.size()) - std::ptrdiff_t(edit.removed);
+        source.replace(edit.offset, edit.removed, edit.inserted);
+        const size_t insertedEnd = edit.offset + edit.inserted.size();
+        
+        // Extraer tokens hasta uno que empiece tras lo insertado donde, en el texto
+        // antiguo, empezaba una sentencia: el Lexer solo depende de la posición, así que
+        // desde ahí los tokens antiguos siguen valiendo, desplazados `delta` bytes
+        TokenBuffer fresh;
+        fresh.text = source;
+        Lexer lexer(source, restart);
+        size_t candidate = std::lower_bound(offsets, offsets + oldCount, edit.offset + edit.removed) - offsets;
+        bool synced = false;
+        for (;;) {
+            const size_t before = fresh.size();
+            lexer.appendTokens(fresh, 0);
+            if (fresh.size() == before || fresh.kinds.back() == TokenKind::END_OF_INPUT) break;
+            
+            const size_t offset = fresh.offsets.back();
+            if (offset < insertedEnd) continue;
+            const size_t oldOffset = size_t(std::ptrdiff_t(offset) - delta);
+            while (candidate < oldCount && tokens.offset(candidate) < oldOffset) ++candidate;
+            if (candidate < oldCount && tokens.offset(candidate) == oldOffset &&
+                std::binary_search(starts.begin(), starts.end() - 1, candidate)) {
+                fresh.kinds.pop_back();
+                fresh.offsets.pop_back();
+                fresh.lengths.pop_back();
+                fresh.numbers.pop_back();
+                synced = true;
+                break;
+            }
+        }
+        
+        // Tokens que de verdad cambiaron, [changeBegin, changeEnd) en los índices nuevos:
+        // fuera de ahí los nuevos son los antiguos (desplazados). Solo se comparan tokens
+        // cuyos caracteres quedan todos antes o todos después de la edición.
+        const size_t oldEnd = synced ? candidate : tokens.size();
+        size_t same = 0;
+        while (same < fresh.size() && firstToken + same < oldEnd &&
+               fresh.offsets[same] + fresh.lengths[same] <= edit.offset &&
+               sameToken(fresh, same, tokens, firstToken + same, 0)) {
+            ++same;
+        }
+        size_t kept = 0;
+        while (kept < fresh.size() - same && oldEnd - kept > firstToken + same &&
+               tokens.offset(oldEnd - 1 - kept) >= edit.offset + edit.removed &&
+               sameToken(fresh, fresh.size() - 1 - kept, tokens, oldEnd - 1 - kept, delta)) {
+            ++kept;
+        }
+        const size_t changeBegin = firstToken + same;
+        const size_t changeEnd = firstToken + fresh.size() - kept;
+        
+        // Los tokens nuevos sustituyen a los antiguos hasta el punto de enganche
+        const std::ptrdiff_t tokenShift = std::ptrdiff_t(fresh.size()) - std::ptrdiff_t(oldEnd - firstToken);
+        const size_t tailStart = firstToken + fresh.size();
+        splice(tokens.kinds, firstToken, oldEnd, fresh.kinds);
+        splice(tokens.offsets, firstToken, oldEnd, fresh.offsets);
+        splice(tokens.lengths, firstToken, oldEnd, fresh.lengths);
+        splice(tokens.numbers, firstToken, oldEnd, fresh.numbers);
+        tokens.text = source;
+        if (synced) {
+            for (size_t i = tailStart; i < tokens.size(); ++i) {
+                tokens.offsets[i] = std::uint32_t(std::ptrdiff_t(tokens.offsets[i]) + delta);
+            }
+            if (tokens.hasError()) tokens.errorPosition = std::uint32_t(std::ptrdiff_t(tokens.errorPosition) + delta);
+        } else {
+            tokens.errorMessage = fresh.errorMessage;
+            tokens.errorPosition = fresh.errorPosition;
+        }
+        document.relexed = fresh.size();
+        
+        // Volver a partir en sentencias desde la primera afectada (ver endsStatement; con
+        // paréntesis o llaves de más la profundidad vuelve a 0) hasta que una empiece
+        // donde empezaba una antigua ya enganchada: las siguientes son las de antes
+        const std::vector<size_t> oldStarts = std::move(starts);
+        const std::vector<char> oldValid = std::move(valid);
+        starts.assign(oldStarts.begin(), oldStarts.begin() + firstStatement);
+        valid.assign(oldValid.begin(), oldValid.begin() + firstStatement);
+        
+        const size_t count = countWithoutEnd(tokens);
+        size_t start = firstToken;
+        size_t reusedFrom = 0;
+        size_t oldReusedFrom = oldValid.size();
+        bool reused = false;
+        int depth = 0;
+        for (size_t i = firstToken; i < count; ++i) {
+            if (i == start && synced && i >= tailStart) {
+                const size_t oldStart = size_t(std::ptrdiff_t(i) - tokenShift);
+                const auto old = std::lower_bound(oldStarts.begin() + firstStatement, oldStarts.end() - 1, oldStart);
+                if (old != oldStarts.end() - 1 && *old == oldStart) {
+                    reusedFrom = starts.size();
+                    oldReusedFrom = old - oldStarts.begin();
+                    reused = true;
+                    valid.resize(reusedFrom);
+                    for (size_t k = oldReusedFrom; k < oldValid.size(); ++k) {
+                        starts.push_back(size_t(std::ptrdiff_t(oldStarts[k]) + tokenShift));
+                        valid.push_back(oldValid[k]);
+                    }
+                    start = count;
+                    break;
+                }
+            }
+            if (endsStatement(tokens, i, depth)) {
+                starts.push_back(start);
+                start = i + 1;
+            }
+            if (depth < 0) depth = 0;
+        }
+        if (start < count) starts.push_back(start);
+        if (!reused) reusedFrom = starts.size();
+        valid.resize(starts.size());
+        starts.push_back(count);
+        
+        // Si los tokens nuevos acaban en un error léxico justo tras la última sentencia
+        // conservada, esta ya no termina en END_OF_INPUT: se vuelve a analizar
+        if (tokens.hasError() && firstStatement == valid.size() && firstStatement > 0) --firstStatement;
+        
+        // Índice antiguo de un token nuevo que empieza (o termina, si `end`) un tramo fuera
+        // de los tokens cambiados; NONE si está dentro
+        const auto toOld = [&](size_t i, bool end) {
+            if (end ? i <= changeBegin : i < changeBegin) return i;
+            return i >= changeEnd ? size_t(std::ptrdiff_t(i) - tokenShift) : NONE;
+        };
+        
+        // ¿Conserva su resultado el tramo [begin, end)? No si toca los tokens cambiados, ni
+        // si termina donde el análisis ve el error léxico (o lo veía antes de la edición)
+        const auto untouched = [&](size_t begin, size_t end) {
+            if (end == count && (tokens.hasError() || oldError)) return false;
+            return end <= changeBegin || begin >= changeEnd;
+        };
+        
+        // Lo que tenían las sentencias antiguas de la zona [firstStatement, oldReusedFrom):
+        // por primer token antiguo, el fin y el resultado de las anidadas (esqueleto:
+        // analizadas con los bloques vaciados) o de la sentencia entera
+        struct OldStatement {
+            size_t end;
+            bool valid;
+            bool skeleton;
+        };
+        std::unordered_map<size_t, OldStatement> oldNested;
+        if (semanticActions.empty()) {
+            for (size_t j = firstStatement; j < oldReusedFrom; ++j) {
+                if (nested[j].empty()) oldNested[oldStarts[j]] = {oldStarts[j + 1], bool(oldValid[j]), false};
+                for (const NestedStatement& n : nested[j]) {
+                    oldNested[oldStarts[j] + n.begin] = {oldStarts[j] + n.end, n.valid, true};
+                }
+            }
+        }
+        
+        // Cada sentencia nueva que no es una antigua intacta se analiza por separado como
+        // lista de sentencias, así que las acciones semánticas solo se ejecutan en ellas.
+        // Con acciones se analiza entera (las acciones ven todos sus tokens); sin ellas,
+        // solo se analizan sus sentencias anidadas que cambiaron.
+        SessionLease session(*this);
+        session->tokens = &tokens;
+        const auto parses = [&](size_t begin, size_t end, const std::vector<std::pair<size_t, size_t>>& blocks) {
+            session->nextTokenIndex = begin;
+            session->tokenEnd = end;
+            session->skips = blocks;
+            session->semanticStack = {};
+            ++document.reparsed;
+            document.reparsedTokenCount += end - begin;
+            for (const auto& block : blocks) document.reparsedTokenCount -= block.second - block.first;
+            try {
+                session->parseFrom(list);
+                return true;
+            } catch (const std::exception&) {
+                return false;
+            }
+        };
+        
+        document.reparsed = 0;
+        document.reparsedTokenCount = 0;
+        std::vector<std::vector<NestedStatement>> newNested;
+        std::vector<BlockStatement> pieces;
+        for (size_t k = firstStatement; k < reusedFrom; ++k) {
+            const size_t begin = starts[k];
+            const size_t end = starts[k + 1];
+            
+            const size_t oldBegin = toOld(begin, false);
+            const auto old = std::lower_bound(oldStarts.begin() + firstStatement, oldStarts.begin() + oldReusedFrom, oldBegin);
+            if (untouched(begin, end) && old != oldStarts.begin() + oldReusedFrom && *old == oldBegin &&
+                old[1] == toOld(end, true)) {
+                const size_t j = old - oldStarts.begin();
+                valid[k] = oldValid[j];
+                newNested.push_back(std::move(nested[j]));
+                continue;
+            }
+            
+            if (!semanticActions.empty()) {
+                valid[k] = parses(begin, end, {});
+                newNested.emplace_back();
+                continue;
+            }
+            
+            if (!blockStatements || !splitBlocks(tokens, begin, end, pieces)) pieces.assign(1, {begin, end, {}});
+            std::vector<NestedStatement> results;
+            bool allValid = true;
+            for (const BlockStatement& piece : pieces) {
+                // Se conserva si no toca los tokens cambiados o si estos caen dentro de uno
+                // de sus bloques y lo que se guardó es su esqueleto
+                bool keep = untouched(piece.begin, piece.end);
+                bool insideBlock = false;
+                for (const auto& block : piece.blocks) {
+                    if (block.first <= changeBegin && changeEnd <= block.second) insideBlock = true;
+                }
+                const auto found = oldNested.find(toOld(piece.begin, false));
+                keep = (keep || insideBlock) && found != oldNested.end() && found->second.end == toOld(piece.end, true) &&
+                       (keep || found->second.skeleton);
+                const bool pieceValid = keep ? found->second.valid : parses(piece.begin, piece.end, piece.blocks);
+                allValid = allValid && pieceValid;
+                results.push_back({std::uint32_t(piece.begin - begin), std::uint32_t(piece.end - begin), pieceValid});
+            }
+            valid[k] = allValid;
+            if (pieces.back().blocks.empty()) results.clear();
+            newNested.push_back(std::move(results));
+        }
+        session->skips.clear();
+        session->semanticStack = {};
+        
+        splice(nested, firstStatement, oldReusedFrom, newNested);
+    }
+    
+    // Aceptado si todas las sentencias lo son y no hay error léxico detrás de ellas. Si
+    // no, el análisis secuencial desde la primera que falla (o desde el final, para el
+    // error léxico) da el diagnóstico del texto completo: las anteriores son sentencias
+    // completas, tras las que el análisis completo espera otra lista de sentencias.
+    const size_t firstInvalid = std::find(valid.begin(), valid.end(), false) - valid.begin();
+    std::ostringstream diagnostics;
+    SessionLease session(*this);
+    session->tokens = &tokens;
+    session->output = nullptr;
+    session->diagnostics = &diagnostics;
+    session->sourceName = document.name;
+    bool accepted = reusable && firstInvalid == valid.size() && !tokens.hasError();
+    if (!accepted) {
+        session->nextTokenIndex = reusable ? starts[firstInvalid] : 0;
+        session->tokenEnd = tokens.size();
+        try {
+            session->parseFrom(reusable ? list : startSymbol);
+            accepted = true;
+        } catch (const std::exception& e) {
+            session->report(e);
+        }
+    }
+    
+    // El Program es el que construye parse() al terminar el análisis
+    document.program = accepted ? session->completeProgram() : nullptr;
+    document.diagnostics = diagnostics.str();
+    return accepted;
+}
+
+} // namespace LL1
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "ll1_parser.hpp"
+
+namespace LL1 {
+
+// Edición de un texto: se sustituyen los `removed` bytes que empiezan en `offset` por
+// `inserted` (el llamador lo mantiene vivo solo durante LL1Parser::reparse)
+struct TextEdit {
+    size_t offset = 0;
+    size_t removed = 0;
+    std::string_view inserted;
+};
+
+// Sentencia de una lista anidada en bloques (o la propia sentencia del nivel superior)
+// con los interiores de sus bloques vaciados: tokens [begin, end) relativos al comienzo
+// de la sentencia del nivel superior, y si se reconoce como lista de sentencias
+struct NestedStatement {
+    std::uint32_t begin;
+    std::uint32_t end;
+    bool valid;
+};
+
+// Documento analizado de forma incremental (ver LL1Parser::parseIncremental y reparse).
+// Guarda el texto, sus tokens y los límites de las sentencias del nivel superior con si
+// cada una se reconoce como lista de sentencias. Tras una edición se vuelven a extraer
+// los tokens desde la sentencia que la contiene hasta que coinciden con los antiguos, y
+// solo se analizan (y solo en ellas corren las acciones semánticas) las sentencias que
+// tocan los tokens cambiados: las demás conservan su resultado. Sin acciones semánticas,
+// dentro de una sentencia cambiada se conservan además las sentencias de sus bloques que
+// no se tocaron, y las demás se analizan con el interior de sus bloques vaciado.
+//
+// Una concatenación de listas de sentencias válidas es válida, así que el texto se acepta
+// si todas lo son; si alguna falla, el diagnóstico sale de analizar en secuencia desde
+// ella hasta el final, y es el mismo que daría el análisis del texto completo.
+class IncrementalParse {
+    friend class LL1Parser;
+
+private:
+    std::string source;
+    std::string name;                      // para los diagnósticos, como en parseMany
+    TokenBuffer tokens;                    // vista sobre `source`
+    std::vector<size_t> starts;            // primer token de cada sentencia y, al final,
+                                           // el número de tokens sin END_OF_INPUT
+    std::vector<char> valid;               // por sentencia
+    std::vector<std::vector<NestedStatement>> nested;   // por sentencia con bloques: las
+                                                        // de sus bloques y ella misma
+    std::unique_ptr<Program> program;      // nulo si el texto actual no es válido
+    std::string diagnostics;
+    size_t relexed = 0;
+    size_t reparsed = 0;
+    size_t reparsedTokenCount = 0;
+    
+    IncrementalParse() = default;
+
+public:
+    IncrementalParse(const IncrementalParse&) = delete;
+    IncrementalParse& operator=(const IncrementalParse&) = delete;
+    
+    const std::string& text() const { return source; }
+    const TokenBuffer& getTokens() const { return tokens; }
+    
+    // Resultado del último análisis, como el de parse() con el mismo nombre de fuente
+    bool accepted() const { return program != nullptr; }
+    const Program* getProgram() const { return program.get(); }
+    const std::string& getDiagnostics() const { return diagnostics; }
+    
+    // Qué hizo el último análisis (para tests y benchmarks)
+    size_t statementCount() const { return valid.size(); }
+    size_t relexedTokens() const { return relexed; }
+    size_t reparsedStatements() const { return reparsed; }   // también las anidadas
+    size_t reparsedTokens() const { return reparsedTokenCount; }
+};
+
+} // namespace LL1
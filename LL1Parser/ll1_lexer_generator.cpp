@@ -0,0 +1,595 @@
+#include "ll1_lexer_generator.hpp"
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+
+namespace LL1 {
+
+namespace {
+
+using ByteSet = std::bitset<256>;
+
+// === NFA de Thompson ===
+
+struct NfaState {
+    std::vector<std::pair<int, int>> edges;   // (conjunto de bytes, destino)
+    std::vector<int> epsilon;
+    int rule = LexerDfa::NO_RULE;
+};
+
+struct Nfa {
+    std::vector<NfaState> states;
+    std::vector<ByteSet> sets;                // conjuntos de bytes de las aristas, sin repetir
+    
+    int addState() {
+        states.emplace_back();
+        return static_cast<int>(states.size()) - 1;
+    }
+    
+    void addEdge(int from, const ByteSet& set, int to) {
+        auto it = std::find(sets.begin(), sets.end(), set);
+        int index = static_cast<int>(it - sets.begin());
+        if (it == sets.end()) sets.push_back(set);
+        states[from].edges.push_back({index, to});
+    }
+    
+    void addEpsilon(int from, int to) { states[from].epsilon.push_back(to); }
+};
+
+struct Fragment {
+    int start;
+    int end;
+};
+
+// Expresiones regulares sobre bytes: alternativa '|', concatenación, '*', '+', '?',
+// grupos, '.' (cualquier byte), clases [a-z] y [^...] y escapes \n \t \r \v \f \0 \xHH
+class RegexCompiler {
+private:
+    Nfa& nfa;
+    const std::string& pattern;
+    size_t pos = 0;
+
+public:
+    RegexCompiler(Nfa& n, const std::string& p) : nfa(n), pattern(p) {}
+    
+    Fragment compile() {
+        Fragment fragment = parseAlternation();
+        if (!atEnd()) fail("unexpected ')'");
+        return fragment;
+    }
+
+private:
+    bool atEnd() const { return pos >= pattern.size(); }
+    
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::runtime_error(message + " at offset " + std::to_string(pos) + " in pattern " + pattern);
+    }
+    
+    Fragment parseAlternation() {
+        Fragment left = parseConcatenation();
+        while (!atEnd() && pattern[pos] == '|') {
+            ++pos;
+            Fragment right = parseConcatenation();
+            int start = nfa.addState();
+            int end = nfa.addState();
+            nfa.addEpsilon(start, left.start);
+            nfa.addEpsilon(start, right.start);
+            nfa.addEpsilon(left.end, end);
+            nfa.addEpsilon(right.end, end);
+            left = {start, end};
+        }
+        return left;
+    }
+    
+    Fragment parseConcatenation() {
+        int start = nfa.addState();
+        Fragment result{start, start};
+        while (!atEnd() && pattern[pos] != '|' && pattern[pos] != ')') {
+            Fragment next = parseRepetition();
+            nfa.addEpsilon(result.end, next.start);
+            result.end = next.end;
+        }
+        return result;
+    }
+    
+    Fragment parseRepetition() {
+        Fragment fragment = parseAtom();
+        while (!atEnd() && (pattern[pos] == '*' || pattern[pos] == '+' || pattern[pos] == '?')) {
+            char op = pattern[pos++];
+            int start = nfa.addState();
+            int end = nfa.addState();
+            nfa.addEpsilon(start, fragment.start);
+            nfa.addEpsilon(fragment.end, end);
+            if (op != '+') nfa.addEpsilon(start, end);                       // cero veces
+            if (op != '?') nfa.addEpsilon(fragment.end, fragment.start);     // repetir
+            fragment = {start, end};
+        }
+        return fragment;
+    }
+    
+    Fragment parseAtom() {
+        char c = pattern[pos++];
+        ByteSet set;
+        switch (c) {
+            case '(': {
+                Fragment group = parseAlternation();
+                if (atEnd()) fail("missing ')'");
+                ++pos;
+                return group;
+            }
+            case '[': set = parseClass(); break;
+            case '.': set.set(); break;
+            case '\\': set.set(parseEscape()); break;
+            case '*': case '+': case '?':
+                fail(std::string("nothing to repeat before '") + c + "'");
+            default: set.set(static_cast<unsigned char>(c)); break;
+        }
+        int start = nfa.addState();
+        int end = nfa.addState();
+        nfa.addEdge(start, set, end);
+        return {start, end};
+    }
+    
+    // Después de '\'
+    unsigned char parseEscape() {
+        if (atEnd()) fail("dangling '\\'");
+        char c = pattern[pos++];
+        switch (c) {
+            case 'n': return '\n';
+            case 't': return '\t';
+            case 'r': return '\r';
+            case 'v': return '\v';
+            case 'f': return '\f';
+            case '0': return '\0';
+            case 'x': {
+                if (pos + 2 > pattern.size() || !std::isxdigit(static_cast<unsigned char>(pattern[pos])) ||
+                    !std::isxdigit(static_cast<unsigned char>(pattern[pos + 1]))) {
+                    fail("bad \\x escape");
+                }
+                unsigned char value = static_cast<unsigned char>(std::stoul(pattern.substr(pos, 2), nullptr, 16));
+                pos += 2;
+                return value;
+            }
+            default: return static_cast<unsigned char>(c);
+        }
+    }
+    
+    // Después de '['
+    ByteSet parseClass() {
+        ByteSet set;
+        bool negate = !atEnd() && pattern[pos] == '^';
+        if (negate) ++pos;
+        
+        while (!atEnd() && pattern[pos] != ']') {
+            unsigned char low = parseClassChar();
+            if (pos + 1 < pattern.size() && pattern[pos] == '-' && pattern[pos + 1] != ']') {
+                ++pos;
+                unsigned char high = parseClassChar();
+                if (high < low) fail("empty range");
+                for (unsigned b = low; b <= high; ++b) set.set(b);
+            } else {
+                set.set(low);
+            }
+        }
+        if (atEnd()) fail("missing ']'");
+        ++pos;
+        return negate ? ~set : set;
+    }
+    
+    unsigned char parseClassChar() {
+        char c = pattern[pos++];
+        return c == '\\' ? parseEscape() : static_cast<unsigned char>(c);
+    }
+};
+
+// Renumera las clases de bytes por orden de primera aparición
+size_t numberClasses(const std::vector<int>& keyOfByte, std::uint8_t byteClass[256]) {
+    std::map<int, std::uint8_t> numbering;
+    for (unsigned b = 0; b < 256; ++b) {
+        auto inserted = numbering.insert({keyOfByte[b], static_cast<std::uint8_t>(numbering.size())});
+        byteClass[b] = inserted.first->second;
+    }
+    return numbering.size();
+}
+
+} // namespace
+
+bool LexerGenerator::parseSpec(std::istream& in, std::vector<TokenRule>& rules) {
+    std::string text;
+    int lineNumber = 0;
+    bool ok = true;
+    
+    while (std::getline(in, text)) {
+        ++lineNumber;
+        if (!text.empty() && text.back() == '\r') text.pop_back();
+        
+        size_t begin = text.find_first_not_of(" \t");
+        if (begin == std::string::npos || text[begin] == '#') continue;
+        
+        size_t nameEnd = text.find_first_of(" \t", begin);
+        size_t patternBegin = nameEnd == std::string::npos ? std::string::npos : text.find_first_not_of(" \t", nameEnd);
+        if (patternBegin == std::string::npos) {
+            std::cerr << "Token spec line " << lineNumber << ": expected 'NAME pattern'" << std::endl;
+            ok = false;
+            continue;
+        }
+        
+        TokenRule rule;
+        rule.name = text.substr(begin, nameEnd - begin);
+        rule.pattern = text.substr(patternBegin, text.find_last_not_of(" \t") + 1 - patternBegin);
+        rule.line = lineNumber;
+        
+        // keyword NOMBRE 'texto'
+        if (rule.name == "keyword") {
+            size_t split = rule.pattern.find_first_of(" \t");
+            size_t literal = split == std::string::npos ? std::string::npos : rule.pattern.find_first_not_of(" \t", split);
+            rule.keyword = true;
+            rule.name = rule.pattern.substr(0, split);
+            rule.pattern = literal == std::string::npos ? "" : rule.pattern.substr(literal);
+        }
+        
+        // 'texto' literal
+        if (rule.pattern.size() >= 2 && rule.pattern.front() == '\'' && rule.pattern.back() == '\'') {
+            rule.pattern = rule.pattern.substr(1, rule.pattern.size() - 2);
+            rule.literal = true;
+            if (rule.pattern.empty()) {
+                std::cerr << "Token spec line " << lineNumber << ": empty literal" << std::endl;
+                ok = false;
+                continue;
+            }
+        }
+        if (rule.keyword && !rule.literal) {
+            std::cerr << "Token spec line " << lineNumber << ": expected 'keyword NAME 'text''" << std::endl;
+            ok = false;
+            continue;
+        }
+        rules.push_back(rule);
+    }
+    
+    return ok;
+}
+
+LexerDfa LexerGenerator::buildDfa(const std::vector<TokenRule>& rules) {
+    // NFA combinado: un estado inicial con transiciones ε al de cada regla
+    Nfa nfa;
+    const int nfaStart = nfa.addState();
+    for (size_t r = 0; r < rules.size(); ++r) {
+        if (rules[r].keyword) continue;
+        Fragment fragment;
+        if (rules[r].literal) {
+            fragment.start = fragment.end = nfa.addState();
+            for (char c : rules[r].pattern) {
+                ByteSet set;
+                set.set(static_cast<unsigned char>(c));
+                int next = nfa.addState();
+                nfa.addEdge(fragment.end, set, next);
+                fragment.end = next;
+            }
+        } else {
+            try {
+                fragment = RegexCompiler(nfa, rules[r].pattern).compile();
+            } catch (const std::runtime_error& e) {
+                throw std::runtime_error("Token spec line " + std::to_string(rules[r].line) + ": " + e.what());
+            }
+        }
+        nfa.addEpsilon(nfaStart, fragment.start);
+        nfa.states[fragment.end].rule = static_cast<int>(r);
+    }
+    
+    // Clases de bytes: bytes que pertenecen exactamente a los mismos conjuntos de aristas
+    std::vector<int> signatureOfByte(256);
+    {
+        std::map<std::vector<bool>, int> signatures;
+        for (unsigned b = 0; b < 256; ++b) {
+            std::vector<bool> signature(nfa.sets.size());
+            for (size_t s = 0; s < nfa.sets.size(); ++s) signature[s] = nfa.sets[s][b];
+            signatureOfByte[b] = signatures.insert({signature, static_cast<int>(signatures.size())}).first->second;
+        }
+    }
+    std::uint8_t nfaClass[256];
+    const size_t nfaClassCount = numberClasses(signatureOfByte, nfaClass);
+    std::vector<unsigned> representative(nfaClassCount);
+    for (unsigned b = 256; b-- > 0;) representative[nfaClass[b]] = b;
+    
+    auto closure = [&nfa](std::vector<int> states) {
+        std::vector<bool> seen(nfa.states.size(), false);
+        for (int s : states) seen[s] = true;
+        for (size_t i = 0; i < states.size(); ++i) {
+            for (int next : nfa.states[states[i]].epsilon) {
+                if (!seen[next]) {
+                    seen[next] = true;
+                    states.push_back(next);
+                }
+            }
+        }
+        std::sort(states.begin(), states.end());
+        return states;
+    };
+    
+    // Construcción por subconjuntos (estado 0: conjunto vacío, es decir, muerto)
+    std::map<std::vector<int>, int> ids;
+    std::vector<std::vector<int>> subsets = {{}, closure({nfaStart})};
+    ids[subsets[0]] = 0;
+    ids[subsets[1]] = 1;
+    std::vector<std::vector<int>> next;
+    for (size_t d = 0; d < subsets.size(); ++d) {
+        next.emplace_back(nfaClassCount, 0);
+        for (size_t c = 0; c < nfaClassCount; ++c) {
+            std::vector<int> target;
+            for (int s : subsets[d]) {
+                for (const auto& edge : nfa.states[s].edges) {
+                    if (nfa.sets[edge.first][representative[c]]) target.push_back(edge.second);
+                }
+            }
+            target = closure(target);
+            target.erase(std::unique(target.begin(), target.end()), target.end());
+            auto inserted = ids.insert({target, static_cast<int>(subsets.size())});
+            if (inserted.second) subsets.push_back(target);
+            next[d][c] = inserted.first->second;
+        }
+    }
+    
+    // Regla aceptada: la de menor índice entre los estados finales del subconjunto
+    std::vector<int> accept(subsets.size(), LexerDfa::NO_RULE);
+    for (size_t d = 0; d < subsets.size(); ++d) {
+        for (int s : subsets[d]) {
+            int rule = nfa.states[s].rule;
+            if (rule != LexerDfa::NO_RULE && (accept[d] == LexerDfa::NO_RULE || rule < accept[d])) accept[d] = rule;
+        }
+    }
+    if (accept[1] != LexerDfa::NO_RULE) {
+        throw std::runtime_error("Token spec line " + std::to_string(rules[accept[1]].line) +
+                                 ": rule " + rules[accept[1]].name + " matches the empty string");
+    }
+    
+    // Minimización: refinar la partición inicial (por regla aceptada) hasta que sea estable
+    std::vector<int> block(subsets.size());
+    size_t blockCount = 0;
+    {
+        std::map<int, int> byRule;
+        for (size_t d = 0; d < subsets.size(); ++d) {
+            block[d] = byRule.insert({accept[d], static_cast<int>(byRule.size())}).first->second;
+        }
+        blockCount = byRule.size();
+    }
+    for (;;) {
+        std::map<std::vector<int>, int> signatures;
+        std::vector<int> refined(subsets.size());
+        for (size_t d = 0; d < subsets.size(); ++d) {
+            std::vector<int> signature = {block[d]};
+            for (size_t c = 0; c < nfaClassCount; ++c) signature.push_back(block[next[d][c]]);
+            refined[d] = signatures.insert({signature, static_cast<int>(signatures.size())}).first->second;
+        }
+        block = refined;
+        if (signatures.size() == blockCount) break;
+        blockCount = signatures.size();
+    }
+    if (block[1] == block[0]) {
+        throw std::runtime_error("Token spec does not match any input");
+    }
+    
+    // Numeración final: muerto = 0, inicial = 1, el resto en orden de recorrido en anchura
+    std::vector<int> stateOfBlock(blockCount, -1);
+    std::vector<int> order = {0, 1};
+    stateOfBlock[block[0]] = 0;
+    stateOfBlock[block[1]] = 1;
+    for (size_t i = 1; i < order.size(); ++i) {
+        for (size_t c = 0; c < nfaClassCount; ++c) {
+            int target = next[order[i]][c];
+            if (stateOfBlock[block[target]] < 0) {
+                stateOfBlock[block[target]] = static_cast<int>(order.size());
+                order.push_back(target);
+            }
+        }
+    }
+    
+    // Fusionar las clases de bytes cuyas columnas coinciden en el DFA mínimo
+    std::vector<int> columnOfByte(256);
+    {
+        std::map<std::vector<int>, int> columns;
+        for (unsigned b = 0; b < 256; ++b) {
+            std::vector<int> column;
+            for (int d : order) column.push_back(stateOfBlock[block[next[d][nfaClass[b]]]]);
+            columnOfByte[b] = columns.insert({column, static_cast<int>(columns.size())}).first->second;
+        }
+    }
+    
+    LexerDfa dfa;
+    dfa.classCount = numberClasses(columnOfByte, dfa.byteClass);
+    std::vector<unsigned> classRepresentative(dfa.classCount);
+    for (unsigned b = 256; b-- > 0;) classRepresentative[dfa.byteClass[b]] = b;
+    
+    for (int d : order) {
+        std::vector<std::uint16_t> row(dfa.classCount);
+        for (size_t c = 0; c < dfa.classCount; ++c) {
+            row[c] = static_cast<std::uint16_t>(stateOfBlock[block[next[d][nfaClass[classRepresentative[c]]]]]);
+        }
+        dfa.transitions.push_back(row);
+        dfa.accept.push_back(accept[d]);
+    }
+    return dfa;
+}
+
+KeywordTable LexerGenerator::buildKeywordTable(const std::vector<TokenRule>& rules, const LexerDfa& dfa) {
+    KeywordTable table;
+    std::vector<int> keywords;
+    std::vector<std::array<unsigned, 4>> keys;   // longitud y caracteres primero, segundo y último
+    for (size_t r = 0; r < rules.size(); ++r) {
+        if (!rules[r].keyword) continue;
+        const std::string& text = rules[r].pattern;
+        const std::string where = "Token spec line " + std::to_string(rules[r].line) + ": keyword " + text;
+        if (text.size() < 2) throw std::runtime_error(where + " is shorter than 2 characters");
+        
+        // El DFA debe reconocer la palabra completa, siempre con la misma regla
+        size_t state = 1;
+        for (char c : text) state = dfa.transitions[state][dfa.byteClass[static_cast<unsigned char>(c)]];
+        int host = dfa.accept[state];
+        if (host == LexerDfa::NO_RULE || (table.hostRule != LexerDfa::NO_RULE && host != table.hostRule)) {
+            throw std::runtime_error(where + " is not matched by the identifier rule");
+        }
+        table.hostRule = host;
+        
+        for (int other : keywords) {
+            if (rules[other].pattern == text) throw std::runtime_error(where + " is declared twice");
+        }
+        
+        if (keywords.empty() || text.size() < table.minLength) table.minLength = text.size();
+        table.maxLength = std::max(table.maxLength, text.size());
+        keywords.push_back(static_cast<int>(r));
+        keys.push_back({static_cast<unsigned>(text.size()), static_cast<unsigned char>(text[0]),
+                        static_cast<unsigned char>(text[1]), static_cast<unsigned char>(text.back())});
+    }
+    if (keywords.empty()) return table;
+    
+    // Búsqueda exhaustiva de multiplicadores pequeños, con la tabla más pequeña posible.
+    // La longitud siempre entra en el hash (m0 > 0): palabras que solo difieren en ella
+    // no pueden compartir posición
+    size_t size = 1;
+    while (size < keywords.size()) size *= 2;
+    for (; size <= 4096; size *= 2) {
+        std::vector<int> slots(size);
+        unsigned stamp = 0;
+        for (unsigned m0 = 1; m0 < 16; ++m0) {
+            for (unsigned m1 = 1; m1 < 32; ++m1) {
+                for (unsigned m2 = 0; m2 < 32; ++m2) {
+                    for (unsigned m3 = 0; m3 < 32; ++m3) {
+                        // slots[h] == stamp: posición ya ocupada en este intento
+                        ++stamp;
+                        bool perfect = true;
+                        for (size_t k = 0; k < keys.size() && perfect; ++k) {
+                            size_t h = (keys[k][0] * m0 + keys[k][1] * m1 + keys[k][2] * m2 + keys[k][3] * m3) & (size - 1);
+                            perfect = slots[h] != static_cast<int>(stamp);
+                            slots[h] = static_cast<int>(stamp);
+                        }
+                        if (!perfect) continue;
+                        
+                        const unsigned multipliers[4] = {m0, m1, m2, m3};
+                        std::copy(multipliers, multipliers + 4, table.multipliers);
+                        table.slots.assign(size, LexerDfa::NO_RULE);
+                        for (size_t k = 0; k < keys.size(); ++k) {
+                            size_t h = (keys[k][0] * m0 + keys[k][1] * m1 + keys[k][2] * m2 + keys[k][3] * m3) & (size - 1);
+                            if (table.slots[h] != LexerDfa::NO_RULE) {
+                                throw std::logic_error("Keyword hash is not perfect: " + rules[keywords[k]].pattern +
+                                                       " and " + rules[table.slots[h]].pattern + " share a slot");
+                            }
+                            table.slots[h] = keywords[k];
+                        }
+                        return table;
+                    }
+                }
+            }
+        }
+    }
+    throw std::runtime_error("No perfect hash found for the keywords");
+}
+
+void LexerGenerator::writeTablesHeader(const LexerDfa& dfa, const KeywordTable& keywords,
+                                       const std::vector<TokenRule>& rules, const std::string& namespaceName,
+                                       const std::string& source, std::ostream& out) {
+    const size_t states = dfa.stateCount();
+    const char* stateType = states <= 0x100 ? "std::uint8_t" : "std::uint16_t";
+    const int stateWidth = static_cast<int>(std::to_string(states - 1).size());
+    auto tokenValue = [&rules](int rule) -> std::string {
+        if (rule == LexerDfa::NO_RULE) return "NO_TOKEN";
+        if (rules[rule].name == "skip") return "SKIP_TOKEN";
+        return "std::uint8_t(TokenKind::" + rules[rule].name + ")";
+    };
+    
+    out << "// Generado por generate_lexer a partir de " << source << ".\n"
+        << "// No editar a mano: regenerar con 'make generate-tables'.\n"
+        << "#pragma once\n\n"
+        << "#include \"ll1_parser.hpp\"\n"
+        << "#include <cstring>\n\n"
+        << "namespace LL1 {\n"
+        << "namespace " << namespaceName << " {\n\n";
+    
+    out << "// Valores de ACCEPT que no son una clase de token\n"
+        << "inline constexpr std::uint8_t NO_TOKEN = 0xFF;     // estado no final\n"
+        << "inline constexpr std::uint8_t SKIP_TOKEN = 0xFE;   // regla 'skip': se descarta\n\n"
+        << "inline constexpr unsigned STATE_COUNT = " << states << ";\n"
+        << "inline constexpr unsigned CLASS_COUNT = " << dfa.classCount << ";\n"
+        << "inline constexpr unsigned DEAD_STATE = 0;\n"
+        << "inline constexpr unsigned START_STATE = 1;\n\n";
+    
+    out << "// Clase de equivalencia de cada byte\n"
+        << "inline constexpr std::uint8_t BYTE_CLASS[256] = {\n";
+    for (unsigned b = 0; b < 256; ++b) {
+        out << (b % 16 == 0 ? "    " : " ") << std::setw(2) << unsigned(dfa.byteClass[b]) << ",";
+        if (b % 16 == 15) out << "\n";
+    }
+    out << "};\n\n";
+    
+    out << "// TRANSITIONS[estado][clase] -> estado siguiente (DEAD_STATE si no hay)\n"
+        << "inline constexpr " << stateType << " TRANSITIONS[STATE_COUNT][CLASS_COUNT] = {\n";
+    for (size_t s = 0; s < states; ++s) {
+        out << "    /* " << std::setw(3) << s << " */ {";
+        for (size_t c = 0; c < dfa.classCount; ++c) {
+            out << (c > 0 ? ", " : "") << std::setw(stateWidth) << dfa.transitions[s][c];
+        }
+        out << "},\n";
+    }
+    out << "};\n\n";
+    
+    out << "// Token aceptado en cada estado: TokenKind, NO_TOKEN o SKIP_TOKEN\n"
+        << "inline constexpr std::uint8_t ACCEPT[STATE_COUNT] = {\n";
+    for (size_t s = 0; s < states; ++s) {
+        out << "    /* " << std::setw(3) << s << " */ ";
+        out << tokenValue(dfa.accept[s]) << ",\n";
+    }
+    out << "};\n\n";
+    
+    const unsigned* m = keywords.multipliers;
+    const size_t mask = keywords.slots.size() - 1;
+    out << "// Palabras reservadas: el DFA las reconoce como KEYWORD_HOST y se distinguen con un\n"
+        << "// hash perfecto (keywordSlot, comprobado por el generador) sobre la longitud y los\n"
+        << "// caracteres primero, segundo y último, y una sola comparación sin copiar el lexema\n"
+        << "inline constexpr std::uint8_t KEYWORD_HOST = " << tokenValue(keywords.hostRule) << ";\n"
+        << "inline constexpr size_t KEYWORD_MIN_LENGTH = " << keywords.minLength << ";\n"
+        << "inline constexpr size_t KEYWORD_MAX_LENGTH = " << keywords.maxLength << ";\n\n"
+        << "struct Keyword {\n"
+        << "    const char* text;\n"
+        << "    std::uint8_t length;\n"
+        << "    std::uint8_t kind;\n"
+        << "};\n\n"
+        << "inline constexpr Keyword KEYWORDS[" << keywords.slots.size() << "] = {\n";
+    for (size_t h = 0; h < keywords.slots.size(); ++h) {
+        int rule = keywords.slots[h];
+        out << "    /* " << std::setw(2) << h << " */ ";
+        if (rule == LexerDfa::NO_RULE) {
+            out << "{\"\", 0, KEYWORD_HOST},\n";
+        } else {
+            out << "{\"" << rules[rule].pattern << "\", " << rules[rule].pattern.size() << ", " << tokenValue(rule) << "},\n";
+        }
+    }
+    out << "};\n\n"
+        << "// Requiere KEYWORD_MIN_LENGTH <= length <= KEYWORD_MAX_LENGTH\n"
+        << "constexpr size_t keywordSlot(const char* text, size_t length) {\n"
+        << "    return (";
+    const char* terms[4] = {"length", "size_t(static_cast<unsigned char>(text[0]))",
+                            "size_t(static_cast<unsigned char>(text[1]))",
+                            "size_t(static_cast<unsigned char>(text[length - 1]))"};
+    bool firstTerm = true;
+    for (int t = 0; t < 4; ++t) {
+        if (m[t] == 0) continue;
+        out << (firstTerm ? "" : " +\n            ") << terms[t];
+        if (m[t] != 1) out << " * " << m[t];
+        firstTerm = false;
+    }
+    out << ") & " << mask << ";\n"
+        << "}\n\n"
+        << "// Clase de token de un lexema que el DFA aceptó como KEYWORD_HOST\n"
+        << "inline std::uint8_t classifyKeyword(const char* text, size_t length) {\n"
+        << "    if (length < KEYWORD_MIN_LENGTH || length > KEYWORD_MAX_LENGTH) return KEYWORD_HOST;\n"
+        << "    const Keyword& keyword = KEYWORDS[keywordSlot(text, length)];\n"
+        << "    return keyword.length == length && std::memcmp(keyword.text, text, length) == 0 ? keyword.kind : KEYWORD_HOST;\n"
+        << "}\n\n"
+        << "} // namespace " << namespaceName << "\n"
+        << "} // namespace LL1\n";
+}
+
+} // namespace LL1
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace LL1 {
+
+// Regla de la especificación de tokens (ver hulk_tokens.spec). El nombre es el de una
+// clase de token (TokenKind) o "skip" para lo que se descarta; ante dos coincidencias
+// de la misma longitud gana la regla que aparece antes.
+struct TokenRule {
+    std::string name;
+    std::string pattern;
+    bool literal = false;    // 'texto' exacto en lugar de expresión regular
+    bool keyword = false;    // palabra reservada: fuera del DFA, va en la KeywordTable
+    int line = 0;            // línea en el archivo de especificación (diagnósticos)
+};
+
+// DFA mínimo sobre el alfabeto de bytes comprimido en clases de equivalencia.
+// El estado 0 es el estado muerto y el 1 el inicial.
+struct LexerDfa {
+    static constexpr int NO_RULE = -1;
+
+    std::uint8_t byteClass[256] = {};
+    size_t classCount = 0;
+    std::vector<std::vector<std::uint16_t>> transitions;   // [estado][clase] -> estado
+    std::vector<int> accept;                               // regla aceptada por estado o NO_RULE
+
+    size_t stateCount() const { return transitions.size(); }
+};
+
+// Palabras reservadas. No están en el DFA: el DFA las reconoce como la regla hostRule
+// (IDENT) y el lexema se busca en una tabla con hash perfecto
+//   (length * m[0] + text[0] * m[1] + text[1] * m[2] + text[length - 1] * m[3]) & (size - 1)
+// de modo que basta una comparación para saber si es una palabra reservada.
+struct KeywordTable {
+    int hostRule = LexerDfa::NO_RULE;
+    size_t minLength = 1;
+    size_t maxLength = 0;
+    unsigned multipliers[4] = {};
+    std::vector<int> slots = {LexerDfa::NO_RULE};   // regla de cada posición o NO_RULE
+};
+
+// Generador de analizadores léxicos: especificación -> NFA (Thompson) -> DFA por
+// subconjuntos -> DFA mínimo (refinamiento de particiones) -> tabla compacta
+class LexerGenerator {
+public:
+    // Lee reglas "NOMBRE patrón" o "keyword NOMBRE 'texto'" (una por línea, '#'
+    // comenta). Los errores se reportan por std::cerr con su línea y devuelven false.
+    static bool parseSpec(std::istream& in, std::vector<TokenRule>& rules);
+
+    // DFA de las reglas que no son palabras reservadas. Lanza std::runtime_error si
+    // algún patrón es inválido.
+    static LexerDfa buildDfa(const std::vector<TokenRule>& rules);
+
+    // Busca los multiplicadores del hash perfecto de las palabras reservadas. Lanza
+    // std::runtime_error si alguna no es un lexema completo de una misma regla del DFA
+    // o si no se encuentra un hash sin colisiones.
+    static KeywordTable buildKeywordTable(const std::vector<TokenRule>& rules, const LexerDfa& dfa);
+
+    // Encabezado con la tabla de clases de bytes, las transiciones, el token que
+    // acepta cada estado (como TokenKind, o SKIP_TOKEN para las reglas "skip") y la
+    // búsqueda de palabras reservadas
+    static void writeTablesHeader(const LexerDfa& dfa, const KeywordTable& keywords,
+                                  const std::vector<TokenRule>& rules, const std::string& namespaceName,
+                                  const std::string& source, std::ostream& out);
+};
+
+} // namespace LL1
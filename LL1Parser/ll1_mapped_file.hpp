@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LL1_HAVE_MMAP 1
+#endif
+
+namespace LL1 {
+
+// Archivo de solo lectura mapeado en memoria (o leído completo donde no hay mmap, y
+// para tuberías, FIFOs o /dev/stdin, que no se pueden mapear). Lo usan la caché binaria de gramáticas y LL1Parser::parseFile.
+class MappedFile {
+private:
+    const char* bytes = nullptr;
+    size_t length = 0;
+    bool opened = false;
+    std::string failure;        // motivo si no se pudo abrir
+#ifdef LL1_HAVE_MMAP
+    void* mapping = nullptr;
+#endif
+    std::vector<char> buffer;   // contenido leído cuando no se puede mapear
+
+public:
+    // Con `sequential`, se avisa al núcleo de que se leerá de principio a fin
+    // (MADV_SEQUENTIAL: lectura anticipada agresiva y páginas leídas liberables)
+    explicit MappedFile(const std::string& path, bool sequential = false) {
+#ifdef LL1_HAVE_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            failure = std::strerror(errno);
+            return;
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            failure = std::strerror(errno);
+        } else if (!S_ISREG(info.st_mode)) {
+            // Su st_size no es el tamaño del contenido: se lee hasta el final
+            char chunk[65536];
+            ssize_t got;
+            while ((got = ::read(fd, chunk, sizeof(chunk))) != 0) {
+                if (got < 0) {
+                    if (errno == EINTR) continue;
+                    failure = std::strerror(errno);
+                    break;
+                }
+                buffer.insert(buffer.end(), chunk, chunk + got);
+            }
+            if (failure.empty()) {
+                bytes = buffer.data();
+                length = buffer.size();
+                opened = true;
+            }
+        } else if (info.st_size == 0) {
+            opened = true;      // vacío: no hay nada que mapear
+        } else {
+            void* addr = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                failure = std::strerror(errno);
+            } else {
+                mapping = addr;
+                bytes = static_cast<const char*>(addr);
+                length = static_cast<size_t>(info.st_size);
+                opened = true;
+                if (sequential) ::madvise(addr, length, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(fd);
+#else
+        (void)sequential;
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            failure = std::strerror(errno);
+            return;
+        }
+        buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        bytes = buffer.data();
+        length = buffer.size();
+        opened = true;
+#endif
+    }
+    
+    ~MappedFile() {
+#ifdef LL1_HAVE_MMAP
+        if (mapping) ::munmap(mapping, length);
+#endif
+    }
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    // Un archivo vacío está abierto, con data() nulo y size() 0
+    bool isOpen() const { return opened; }
+    const std::string& error() const { return failure; }
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+} // namespace LL1
@@ -0,0 +1,170 @@
+#include "ll1_parallel_lexer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+
+namespace LL1 {
+
+namespace {
+
+// Trozo [begin, end) de la entrada y su análisis especulativo (las posiciones de los
+// tokens son ya las de toda la entrada)
+struct Chunk {
+    size_t begin = 0;
+    size_t end = 0;
+    TokenBuffer tokens;
+};
+
+} // namespace
+
+ParallelLexer::ParallelLexer(unsigned threadCount, size_t minChunk)
+    : threads(threadCount ? threadCount : std::max(1u, std::thread::hardware_concurrency())),
+      minChunkSize(std::max<size_t>(minChunk, 1)) {}
+
+ParallelLexer::~ParallelLexer() {
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) worker.join();
+}
+
+void ParallelLexer::runOnWorkers(const std::function<void()>& work) {
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        while (workers.size() + 1 < threads) workers.emplace_back(&ParallelLexer::workerLoop, this);
+        job = &work;
+        ++generation;
+        running = static_cast<unsigned>(workers.size());
+    }
+    wake.notify_all();
+    // Aunque falle, los auxiliares siguen usando `work` hasta que acaban
+    std::exception_ptr error;
+    try {
+        work();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    
+    std::unique_lock<std::mutex> lock(workerMutex);
+    finished.wait(lock, [this] { return running == 0; });
+    job = nullptr;
+    if (error) std::rethrow_exception(error);
+}
+
+void ParallelLexer::workerLoop() {
+    unsigned seen = 0;
+    for (;;) {
+        const std::function<void()>* current;
+        {
+            std::unique_lock<std::mutex> lock(workerMutex);
+            wake.wait(lock, [this, seen] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            current = job;
+        }
+        (*current)();
+        
+        std::lock_guard<std::mutex> lock(workerMutex);
+        if (--running == 0) finished.notify_one();
+    }
+}
+
+void ParallelLexer::tokenize(std::string_view input, TokenBuffer& tokens) {
+    stats = Stats();
+    
+    // Varios trozos por hilo, para repartir mejor la carga entre ellos
+    const size_t chunkCount = std::min<size_t>(input.size() / minChunkSize, size_t(threads) * 4);
+    if (chunkCount < 2) {
+        stats.chunks = 1;
+        Lexer(input).tokenizeAll(tokens);
+        return;
+    }
+    if (input.size() > UINT32_MAX) {
+        throw std::runtime_error("Input too large to tokenize: " + std::to_string(input.size()) + " bytes");
+    }
+    
+    // Cortes: el primer salto de línea en la primera mitad del trozo nominal, donde es
+    // más probable no estar dentro de un token (las cadenas rara vez ocupan varias líneas)
+    std::vector<Chunk> chunks(chunkCount);
+    const size_t nominal = input.size() / chunkCount;
+    for (size_t k = 1; k < chunkCount; ++k) {
+        size_t cut = k * nominal;
+        const size_t newline = input.substr(cut, nominal / 2).find('\n');
+        if (newline != std::string_view::npos) cut += newline + 1;
+        chunks[k].begin = cut;
+        chunks[k - 1].end = cut;
+    }
+    chunks.back().end = input.size();
+    stats.chunks = chunkCount;
+    
+    // Análisis especulativo de cada trozo (el primero es exacto); los hilos toman el
+    // siguiente trozo libre de un contador compartido
+    std::atomic<size_t> nextChunk(0);
+    runOnWorkers([&input, &chunks, &nextChunk]() {
+        for (size_t k = nextChunk++; k < chunks.size(); k = nextChunk++) {
+            Chunk& chunk = chunks[k];
+            chunk.tokens.text = input;
+            Lexer(input, chunk.begin).appendTokens(chunk.tokens, chunk.end);
+        }
+    });
+    
+    // Unir en orden. El último token de `tokens` es siempre exacto y, mientras no sea el
+    // final de la entrada ni haya error, es el primero que empieza en el trozo siguiente
+    // (o más allá): es el punto en que hay que engancharse a ese trozo.
+    tokens.clear();
+    tokens.text = input;
+    size_t reserve = 0;
+    for (const Chunk& chunk : chunks) reserve += chunk.tokens.size();
+    tokens.kinds.reserve(reserve);
+    tokens.offsets.reserve(reserve);
+    tokens.lengths.reserve(reserve);
+    tokens.numbers.reserve(reserve);
+    
+    for (size_t k = 0; k < chunks.size(); ++k) {
+        Chunk& chunk = chunks[k];
+        const TokenBuffer& speculative = chunk.tokens;
+        size_t first = 0;                      // primer token del trozo que se copia
+        if (k > 0) {
+            if (tokens.hasError() || tokens.kinds.back() == TokenKind::END_OF_INPUT) break;
+            
+            // Buscar el token exacto entre los especulativos; si no está, seguir analizando
+            // tras él hasta dar con uno que sí esté o salir del trozo.
+            const std::uint32_t* begin = speculative.offsets.data();
+            const std::uint32_t* end = begin + speculative.size();
+            const std::uint32_t* match = std::lower_bound(begin, end, tokens.offsets.back());
+            if (match == end || *match != tokens.offsets.back()) {
+                ++stats.resynchronizedChunks;
+                const size_t last = tokens.size() - 1;
+                Lexer lexer(input, tokens.offsets[last] + tokens.lengths[last]);
+                for (bool synced = false; !synced;) {
+                    const size_t before = tokens.size();
+                    lexer.appendTokens(tokens, 0);    // un token (o el error)
+                    if (tokens.size() == before) break;
+                    ++stats.relexedTokens;
+                    
+                    const std::uint32_t offset = tokens.offsets.back();
+                    if (tokens.kinds.back() == TokenKind::END_OF_INPUT || offset >= chunk.end) break;
+                    match = std::lower_bound(match == end ? begin : match, end, offset);
+                    synced = match != end && *match == offset;
+                }
+                if (tokens.hasError() || match == end || *match != tokens.offsets.back()) continue;
+            }
+            first = static_cast<size_t>(match - begin) + 1;
+        }
+        
+        // Copiar el resto del trozo tal cual: las posiciones no dependen de dónde empezó
+        auto append = [first](auto& to, const auto& from) { to.insert(to.end(), from.begin() + first, from.end()); };
+        append(tokens.kinds, speculative.kinds);
+        append(tokens.offsets, speculative.offsets);
+        append(tokens.lengths, speculative.lengths);
+        append(tokens.numbers, speculative.numbers);
+        tokens.errorMessage = speculative.errorMessage;
+        tokens.errorPosition = speculative.errorPosition;
+    }
+}
+
+} // namespace LL1
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "ll1_parser.hpp"
+#include <condition_variable>
+#include <thread>
+
+namespace LL1 {
+
+// Análisis léxico en paralelo de entradas grandes. La entrada se parte en trozos (cada
+// corte se mueve justo después de un salto de línea si hay uno cerca) y cada trozo se
+// analiza con el mismo Lexer en un hilo, suponiendo que empieza fuera de un token. Esa
+// suposición es especulativa: un corte puede caer dentro de una cadena o de un token
+// largo. Al unir los trozos en orden, el primer token exacto que empieza dentro del
+// trozo siguiente se busca entre sus tokens; si está, desde ahí ambos análisis coinciden
+// (el Lexer solo depende de la posición) y se copian tal cual. Si no, se vuelve a
+// analizar en secuencia hasta encontrar un token común. El resultado es idéntico al de
+// Lexer::tokenizeAll, errores incluidos.
+//
+// Los hilos auxiliares son del objeto: se crean en el primer tokenize que parte la
+// entrada y esperan al siguiente hasta el destructor. Un mismo ParallelLexer no admite
+// llamadas a tokenize simultáneas (LL1Parser lo protege con un mutex).
+class ParallelLexer {
+public:
+    static constexpr size_t DEFAULT_MIN_CHUNK_SIZE = size_t(1) << 20;
+    
+    // Qué hizo el último tokenize (para tests y benchmarks)
+    struct Stats {
+        size_t chunks = 0;
+        size_t resynchronizedChunks = 0;   // trozos cuya especulación no coincidía al empezar
+        size_t relexedTokens = 0;          // tokens analizados otra vez al unir
+    };
+    
+    // threads = 0: un hilo por núcleo. Las entradas de menos de dos trozos de
+    // minChunkSize bytes se analizan en secuencia.
+    explicit ParallelLexer(unsigned threads = 0, size_t minChunkSize = DEFAULT_MIN_CHUNK_SIZE);
+    ~ParallelLexer();
+    
+    ParallelLexer(const ParallelLexer&) = delete;
+    ParallelLexer& operator=(const ParallelLexer&) = delete;
+    
+    // Como Lexer(input).tokenizeAll(tokens), sin índice estructural
+    void tokenize(std::string_view input, TokenBuffer& tokens);
+    
+    unsigned threadCount() const { return threads; }
+    const Stats& lastStats() const { return stats; }
+
+private:
+    // Ejecuta `work` en el hilo que llama y en todos los auxiliares, y espera a que acaben
+    void runOnWorkers(const std::function<void()>& work);
+    void workerLoop();
+    
+    unsigned threads;
+    size_t minChunkSize;
+    Stats stats;
+    
+    std::vector<std::thread> workers;               // threads - 1 auxiliares
+    std::mutex workerMutex;
+    std::condition_variable wake;                   // trabajo nuevo o parada
+    std::condition_variable finished;               // un auxiliar terminó el trabajo
+    const std::function<void()>* job = nullptr;
+    unsigned generation = 0;                        // cuenta los trabajos publicados
+    unsigned running = 0;                           // auxiliares con el trabajo actual
+    bool stopping = false;
+};
+
+} // namespace LL1
@@ -0,0 +1,200 @@
+#include "ll1_parser.hpp"
+#include "ll1_mapped_file.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace LL1 {
+
+namespace {
+
+// Entradas [begin, end) pendientes de un hilo. El dueño toma del principio y los demás
+// roban del final; cada una en su propia línea de caché para no compartirlas.
+struct alignas(64) WorkRange {
+    std::mutex mutex;
+    size_t begin = 0;
+    size_t end = 0;
+};
+
+// Reparto con robo de trabajo: cada hilo empieza con un bloque contiguo de entradas y,
+// cuando lo termina, roba la mitad de lo que le queda a otro
+class WorkStealingQueue {
+private:
+    std::vector<WorkRange> ranges;
+
+public:
+    WorkStealingQueue(size_t items, size_t workers) : ranges(workers) {
+        for (size_t w = 0; w < workers; ++w) {
+            ranges[w].begin = items * w / workers;
+            ranges[w].end = items * (w + 1) / workers;
+        }
+    }
+    
+    // Siguiente entrada para el hilo `self`; false cuando ya no queda ninguna
+    bool next(size_t self, size_t& item) {
+        WorkRange& own = ranges[self];
+        {
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (own.begin < own.end) {
+                item = own.begin++;
+                return true;
+            }
+        }
+        
+        for (size_t k = 1; k < ranges.size(); ++k) {
+            WorkRange& victim = ranges[(self + k) % ranges.size()];
+            size_t begin;
+            size_t end;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                const size_t remaining = victim.end - victim.begin;
+                if (remaining == 0) continue;
+                end = victim.end;
+                begin = end - (remaining + 1) / 2;
+                victim.end = begin;
+            }
+            
+            // El rango propio está vacío: nadie más lo modifica hasta que se publica
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = begin + 1;
+            own.end = end;
+            item = begin;
+            return true;
+        }
+        return false;
+    }
+};
+
+// Tamaño mínimo (en tokens) de cada trozo en el análisis de sentencias en paralelo
+constexpr size_t MIN_STATEMENT_CHUNK = 16 * 1024;
+
+} // namespace
+
+std::vector<ParseResult> LL1Parser::parseMany(const std::vector<ParseSource>& sources, unsigned threads) const {
+    std::vector<ParseResult> results(sources.size());
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    const size_t workers = std::min<size_t>(threads, sources.size());
+    if (workers == 0) return results;
+    
+    WorkStealingQueue queue(sources.size(), workers);
+    auto worker = [this, &sources, &results, &queue](size_t self) {
+        // Una sesión por hilo para todas sus entradas: sus buffers se reutilizan
+        SessionLease session(*this);
+        std::ostringstream diagnostics;
+        
+        size_t index;
+        while (queue.next(self, index)) {
+            const ParseSource& source = sources[index];
+            ParseResult& result = results[index];
+            const auto start = std::chrono::steady_clock::now();
+            
+            diagnostics.str(std::string());
+            session->output = nullptr;
+            session->diagnostics = &diagnostics;
+            try {
+                if (source.isFile) {
+                    MappedFile file(source.name, true);
+                    if (file.isOpen()) {
+                        result.program = parseText(*session.session, std::string_view(file.data(), file.size()), source.name, false);
+                    } else {
+                        diagnostics << source.name << ": Cannot read file: " << file.error() << std::endl;
+                    }
+                } else {
+                    result.program = parseText(*session.session, source.text, source.name, false);
+                }
+            } catch (const std::exception& e) {
+                // Errores fuera del análisis (entrada demasiado grande, memoria...)
+                if (!source.name.empty()) diagnostics << source.name << ": ";
+                diagnostics << "Parse error: " << e.what() << std::endl;
+                result.program.reset();
+            }
+            session->reset();
+            
+            result.diagnostics = diagnostics.str();
+            result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+    };
+    
+    std::vector<std::thread> pool;
+    for (size_t w = 1; w < workers; ++w) pool.emplace_back(worker, w);
+    worker(0);
+    for (auto& thread : pool) thread.join();
+    return results;
+}
+
+// Una sentencia del nivel superior acaba en ';' a profundidad 0 o en la '}' que vuelve a
+// profundidad 0 sin ';' detrás (una función con cuerpo de bloque). `depth` puede quedar
+// negativa con paréntesis o llaves de más; qué hacer entonces lo decide quien llama.
+bool LL1Parser::endsStatement(const TokenBuffer& tokens, size_t i, int& depth) {
+    switch (tokens.kind(i)) {
+    case TokenKind::LPAREN:
+    case TokenKind::LBRACE:
+        ++depth;
+        return false;
+    case TokenKind::RPAREN:
+        --depth;
+        return false;
+    case TokenKind::RBRACE:
+        return --depth == 0 && !(i + 1 < tokens.size() && tokens.kind(i + 1) == TokenKind::SEMICOLON);
+    case TokenKind::SEMICOLON:
+        return depth == 0;
+    default:
+        return false;
+    }
+}
+
+// Análisis de las sentencias del nivel superior en paralelo (ver setStatementThreads).
+// Cada trozo es una secuencia de sentencias completas, así que si todos se reconocen
+// como lista de sentencias L, su concatenación también lo es y la entrada es válida.
+// Devuelve false si no se pudo usar o algún trozo falló: entonces toca el análisis
+// secuencial, que no se ha empezado (la sesión queda como estaba).
+bool LL1Parser::parseStatements(ParseSession& session) const {
+    const TokenBuffer& tokens = *session.tokens;
+    if (statementListCode == INVALID_SYMBOL_ID || !semanticActions.empty() || tokens.hasError()) return false;
+    
+    const unsigned threads = statementThreads ? statementThreads : std::max(1u, std::thread::hardware_concurrency());
+    const size_t count = tokens.size() - 1;          // sin el END_OF_INPUT final
+    const size_t chunkCount = std::min<size_t>(count / MIN_STATEMENT_CHUNK, size_t(threads) * 4);
+    if (chunkCount < 2) return false;
+    
+    // Cortes: el primer fin de sentencia a partir de cada posición nominal
+    std::vector<size_t> cuts = {0};
+    int depth = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const bool end = endsStatement(tokens, i, depth);
+        if (depth < 0) return false;
+        if (end && i + 1 >= cuts.size() * count / chunkCount) cuts.push_back(i + 1);
+    }
+    if (cuts.back() != count) cuts.push_back(count);
+    if (cuts.size() < 3) return false;
+    
+    // Cada hilo analiza con su propia sesión el siguiente trozo libre; al primer fallo
+    // los demás dejan de empezar trozos nuevos
+    std::atomic<size_t> nextChunk(0);
+    std::atomic<bool> failed(false);
+    const SymbolId list = statementListCode & ~NON_TERMINAL_FLAG;
+    auto worker = [this, &tokens, &cuts, &nextChunk, &failed, list]() {
+        SessionLease chunk(*this);
+        for (size_t k = nextChunk++; k + 1 < cuts.size() && !failed; k = nextChunk++) {
+            chunk->tokens = &tokens;
+            chunk->nextTokenIndex = cuts[k];
+            chunk->tokenEnd = cuts[k + 1];
+            try {
+                chunk->parseFrom(list);
+            } catch (const std::exception&) {
+                failed = true;
+            }
+        }
+    };
+    
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < std::min<size_t>(threads, cuts.size() - 1); ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& thread : pool) thread.join();
+    return !failed;
+}
+
+} // namespace LL1
@@ -1,358 +1,632 @@
 #include "ll1_parser.hpp"
+#include "ll1_mapped_file.hpp"
+#include "ll1_parallel_lexer.hpp"
+#include "ll1_streaming_lexer.hpp"
 #include "semantic_nodes.hpp"
-#include <cctype>
+#include "hulk_lexer_tables.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
 #include <iostream>
 #include <stdexcept>
 
 namespace LL1 {
 
-// Implementación del Lexer
-char Lexer::peek(int offset) const {
-    size_t pos = position + offset;
-    if (pos >= input.size()) return '\0';
-    return input[pos];
+const Symbol& tokenKindSymbol(TokenKind kind) {
+    static const Symbol symbols[] = {
+        END_OF_INPUT,
+        Symbol(SymbolType::TERMINAL, "NUMBER"),
+        Symbol(SymbolType::TERMINAL, "STRING"),
+        Symbol(SymbolType::TERMINAL, "IDENT"),
+        Symbol(SymbolType::TERMINAL, "LET"),
+        Symbol(SymbolType::TERMINAL, "IN"),
+        Symbol(SymbolType::TERMINAL, "IF"),
+        Symbol(SymbolType::TERMINAL, "ELSE"),
+        Symbol(SymbolType::TERMINAL, "ELIF"),
+        Symbol(SymbolType::TERMINAL, "WHILE"),
+        Symbol(SymbolType::TERMINAL, "FOR"),
+        Symbol(SymbolType::TERMINAL, "FUNCTION"),
+        Symbol(SymbolType::TERMINAL, "TYPE"),
+        Symbol(SymbolType::TERMINAL, "INHERITS"),
+        Symbol(SymbolType::TERMINAL, "NEW"),
+        Symbol(SymbolType::TERMINAL, "SELF"),
+        Symbol(SymbolType::TERMINAL, "BASE"),
+        Symbol(SymbolType::TERMINAL, "TRUE"),
+        Symbol(SymbolType::TERMINAL, "FALSE"),
+        Symbol(SymbolType::TERMINAL, "ASSIGN_DESTRUCT"),
+        Symbol(SymbolType::TERMINAL, "EQ"),
+        Symbol(SymbolType::TERMINAL, "NEQ"),
+        Symbol(SymbolType::TERMINAL, "LE"),
+        Symbol(SymbolType::TERMINAL, "GE"),
+        Symbol(SymbolType::TERMINAL, "AND"),
+        Symbol(SymbolType::TERMINAL, "OR"),
+        Symbol(SymbolType::TERMINAL, "CONCAT"),
+        Symbol(SymbolType::TERMINAL, "ARROW"),
+        Symbol(SymbolType::TERMINAL, "PLUS"),
+        Symbol(SymbolType::TERMINAL, "MINUS"),
+        Symbol(SymbolType::TERMINAL, "MULT"),
+        Symbol(SymbolType::TERMINAL, "DIV"),
+        Symbol(SymbolType::TERMINAL, "MOD"),
+        Symbol(SymbolType::TERMINAL, "POW"),
+        Symbol(SymbolType::TERMINAL, "LESS_THAN"),
+        Symbol(SymbolType::TERMINAL, "GREATER_THAN"),
+        Symbol(SymbolType::TERMINAL, "ASSIGN"),
+        Symbol(SymbolType::TERMINAL, "LPAREN"),
+        Symbol(SymbolType::TERMINAL, "RPAREN"),
+        Symbol(SymbolType::TERMINAL, "LBRACE"),
+        Symbol(SymbolType::TERMINAL, "RBRACE"),
+        Symbol(SymbolType::TERMINAL, "COMMA"),
+        Symbol(SymbolType::TERMINAL, "SEMICOLON"),
+        Symbol(SymbolType::TERMINAL, "DOT"),
+    };
+    static_assert(sizeof(symbols) / sizeof(symbols[0]) == static_cast<size_t>(TokenKind::COUNT),
+                  "tokenKindSymbol out of sync with TokenKind");
+    return symbols[static_cast<size_t>(kind)];
 }
 
-char Lexer::advance() {
-    if (position >= input.size()) return '\0';
+namespace {
+
+// Valor de un literal de cadena: sin comillas y con los escapes resueltos. El lexema
+// puede no tener comilla de cierre, e incluso terminar en '\', si la entrada se acaba
+// antes; más allá del lexema se lee '\0', como al final de la entrada.
+std::string unescapeString(std::string_view lexeme) {
+    auto at = [&lexeme](size_t i) { return i < lexeme.size() ? lexeme[i] : '\0'; };
     
-    char ch = input[position++];
-    if (ch == '\n') {
-        line++;
-        column = 1;
-    } else {
-        column++;
+    std::string value;
+    for (size_t i = 1; at(i) != '"' && at(i) != '\0'; ++i) {
+        if (at(i) == '\\') {
+            ++i;
+            switch (at(i)) {
+                case 'n': value += '\n'; break;
+                case 't': value += '\t'; break;
+                case 'r': value += '\r'; break;
+                case '\\': value += '\\'; break;
+                case '"': value += '"'; break;
+                default: value += at(i); break;
+            }
+        } else {
+            value += at(i);
+        }
     }
-    return ch;
+    return value;
+}
+
+} // namespace
+
+std::string Token::stringValue() const {
+    return kind == TokenKind::STRING ? unescapeString(lexeme) : std::string();
 }
 
-void Lexer::skipWhitespace() {
-    while (position < input.size() && std::isspace(peek())) {
-        advance();
+// Implementación del Lexer
+Lexer::Lexer(std::string_view text, size_t start) : input(text), position(start) {
+    if (input.size() > UINT32_MAX) {
+        throw std::runtime_error("Input too large to tokenize: " + std::to_string(input.size()) + " bytes");
     }
 }
 
-Token Lexer::makeToken(const Symbol& symbol, const std::string& lexeme) {
-    std::string lex = lexeme.empty() ? std::string(1, input[position - 1]) : lexeme;
-    return Token(symbol, lex, line, column - lex.size());
+char Lexer::advance() {
+    return position < input.size() ? input[position++] : '\0';
 }
 
-Token Lexer::readNumber() {
-    size_t start = position;
-    
-    // Leer parte entera
-    while (std::isdigit(peek())) {
-        advance();
+void Lexer::useStructuralIndex(StructuralIndex::Isa isa) {
+    index = std::make_unique<const StructuralIndex>(input, isa);
+}
+
+// Atajos con el índice estructural para los tokens largos; reconocen exactamente lo
+// mismo que las reglas IDENT, NUMBER y STRING de hulk_tokens.spec. NO_TOKEN: usar el DFA.
+std::uint8_t Lexer::scanIndexed(size_t& end) const {
+    const unsigned char c = static_cast<unsigned char>(input[position]);
+    
+    // Identificador (o palabra reservada): hasta el primer byte fuera de [A-Za-z0-9_]
+    if (unsigned((c | 0x20) - 'a') < 26 || c == '_') {
+        end = index->skipIdentifier(position);
+        return HulkLexer::KEYWORD_HOST;
     }
     
-    // Leer parte decimal si existe
-    if (peek() == '.' && std::isdigit(peek(1))) {
-        advance(); // consumir '.'
-        while (std::isdigit(peek())) {
-            advance();
+    // Número: dígitos y, si siguen '.' y otro dígito, la parte decimal
+    if (unsigned(c - '0') < 10) {
+        end = index->skipDigits(position);
+        if (end + 1 < input.size() && input[end] == '.' && unsigned(input[end + 1] - '0') < 10) {
+            end = index->skipDigits(end + 1);
         }
+        return static_cast<std::uint8_t>(TokenKind::NUMBER);
     }
     
-    std::string numberStr = input.substr(start, position - start);
-    Token token(Symbol(SymbolType::TERMINAL, "NUMBER"), numberStr, line, column - numberStr.size());
-    token.numberValue = std::stod(numberStr);
+    // Cadena: saltando de una comilla, barra invertida o byte nulo al siguiente
+    if (c == '"') {
+        size_t pos = position + 1;
+        for (;;) {
+            pos = index->findStringSpecial(pos);
+            if (pos >= input.size() || input[pos] == '\0') break;
+            if (input[pos] == '"') {
+                ++pos;
+                break;
+            }
+            pos += 2;   // '\' y el carácter escapado, sea cual sea
+        }
+        end = std::min(pos, input.size());
+        return static_cast<std::uint8_t>(TokenKind::STRING);
+    }
     
+    return HulkLexer::NO_TOKEN;
+}
+
+Token Lexer::nextToken() {
+    Token token;
+    scanToken(token);   // con toda la entrada disponible siempre hay token
     return token;
 }
 
-Token Lexer::readString() {
-    size_t start = position;
-    advance(); // consumir '"' inicial
-    
-    std::string value;
-    while (peek() != '"' && peek() != '\0') {
-        if (peek() == '\\') {
-            advance();
-            switch (peek()) {
-                case 'n': value += '\n'; break;
-                case 't': value += '\t'; break;
-                case 'r': value += '\r'; break;
-                case '\\': value += '\\'; break;
-                case '"': value += '"'; break;
-                default: value += peek(); break;
+// Siguiente token en `token`. Con partialInput, si el lexema (o los espacios) llega al
+// final de lo disponible, más texto podría alargarlo: devuelve false sin consumirlo.
+bool Lexer::scanToken(Token& token) {
+    for (;;) {
+        // Con índice, los espacios se saltan de una vez
+        if (index) position = index->skipWhitespace(position);
+        
+        if (position >= input.size()) {
+            if (partialInput) return false;
+            token = Token(TokenKind::END_OF_INPUT, "$", static_cast<std::uint32_t>(position));
+            return true;
+        }
+        
+        const size_t start = position;
+        size_t end = start;
+        std::uint8_t accepted = index ? scanIndexed(end) : HulkLexer::NO_TOKEN;
+        bool reachedEnd = end == input.size();
+        
+        // Recorrer el DFA hasta el estado muerto recordando el último estado final
+        if (accepted == HulkLexer::NO_TOKEN) {
+            unsigned state = HulkLexer::START_STATE;
+            size_t pos = start;
+            for (; pos < input.size(); ++pos) {
+                state = HulkLexer::TRANSITIONS[state][HulkLexer::BYTE_CLASS[static_cast<unsigned char>(input[pos])]];
+                if (state == HulkLexer::DEAD_STATE) break;
+                if (HulkLexer::ACCEPT[state] != HulkLexer::NO_TOKEN) {
+                    accepted = HulkLexer::ACCEPT[state];
+                    end = pos + 1;
+                }
             }
-        } else {
-            value += peek();
+            reachedEnd = pos == input.size();
+        }
+        if (partialInput && reachedEnd) return false;
+        
+        if (accepted == HulkLexer::NO_TOKEN) {
+            char ch = advance();
+            throw std::runtime_error("Unexpected character: " + std::string(1, ch));
+        }
+        
+        // Valor de los números sobre el propio texto: from_chars no reserva memoria ni
+        // depende del locale, y redondea igual que strtod
+        double number = 0.0;
+        if (accepted == static_cast<std::uint8_t>(TokenKind::NUMBER)) {
+            auto [last, failure] = std::from_chars(input.data() + start, input.data() + end, number);
+            if (failure != std::errc() || last != input.data() + end) {
+                advance();
+                throw std::runtime_error("Number out of range: " + std::string(input.substr(start, end - start)));
+            }
+        }
+        
+        position = end;
+        if (accepted == HulkLexer::SKIP_TOKEN) continue;
+        
+        // Las palabras reservadas llegan como identificadores: hash perfecto sobre el buffer
+        if (accepted == HulkLexer::KEYWORD_HOST) {
+            accepted = HulkLexer::classifyKeyword(input.data() + start, end - start);
         }
-        advance();
+        
+        const TokenKind kind = static_cast<TokenKind>(accepted);
+        std::string_view lexeme = input.substr(start, end - start);
+        token = Token(kind, lexeme, static_cast<std::uint32_t>(start));
+        token.numberValue = number;
+        return true;
     }
+}
+
+Token Lexer::peekToken() {
+    size_t oldPos = position;
     
-    if (peek() == '"') {
-        advance(); // consumir '"' final
-    }
+    Token token = nextToken();
     
-    std::string lexeme = input.substr(start, position - start);
-    Token token(Symbol(SymbolType::TERMINAL, "STRING"), lexeme, line, column - lexeme.size());
-    token.stringValue = value;
+    position = oldPos;
     
     return token;
 }
 
-Token Lexer::readIdentifier() {
-    size_t start = position;
-    
-    while (std::isalnum(peek()) || peek() == '_') {
-        advance();
-    }
-    
-    std::string identifier = input.substr(start, position - start);
-    
-    // Verificar palabras reservadas
-    if (identifier == "let") return makeToken(Symbol(SymbolType::TERMINAL, "LET"), identifier);
-    if (identifier == "in") return makeToken(Symbol(SymbolType::TERMINAL, "IN"), identifier);
-    if (identifier == "if") return makeToken(Symbol(SymbolType::TERMINAL, "IF"), identifier);
-    if (identifier == "else") return makeToken(Symbol(SymbolType::TERMINAL, "ELSE"), identifier);
-    if (identifier == "elif") return makeToken(Symbol(SymbolType::TERMINAL, "ELIF"), identifier);
-    if (identifier == "while") return makeToken(Symbol(SymbolType::TERMINAL, "WHILE"), identifier);
-    if (identifier == "for") return makeToken(Symbol(SymbolType::TERMINAL, "FOR"), identifier);
-    if (identifier == "function") return makeToken(Symbol(SymbolType::TERMINAL, "FUNCTION"), identifier);
-    if (identifier == "type") return makeToken(Symbol(SymbolType::TERMINAL, "TYPE"), identifier);
-    if (identifier == "inherits") return makeToken(Symbol(SymbolType::TERMINAL, "INHERITS"), identifier);
-    if (identifier == "new") return makeToken(Symbol(SymbolType::TERMINAL, "NEW"), identifier);
-    if (identifier == "self") return makeToken(Symbol(SymbolType::TERMINAL, "SELF"), identifier);
-    if (identifier == "base") return makeToken(Symbol(SymbolType::TERMINAL, "BASE"), identifier);
-    if (identifier == "true") return makeToken(Symbol(SymbolType::TERMINAL, "TRUE"), identifier);
-    if (identifier == "false") return makeToken(Symbol(SymbolType::TERMINAL, "FALSE"), identifier);
-    
-    return makeToken(Symbol(SymbolType::TERMINAL, "IDENT"), identifier);
+void Lexer::tokenizeAll(TokenBuffer& tokens) {
+    tokens.clear();
+    tokens.text = input;
+    appendTokens(tokens, input.size());
 }
 
-Token Lexer::nextToken() {
-    skipWhitespace();
-    
-    if (position >= input.size()) {
-        return Token(END_OF_INPUT, "$", line, column);
-    }
-    
-    char ch = peek();
-    
-    // Números
-    if (std::isdigit(ch)) {
-        return readNumber();
+// Añade los tokens que empiezan antes de `limit` y el primero que empieza en `limit` o
+// después (o END_OF_INPUT). Un error léxico queda en el buffer y termina el análisis.
+void Lexer::appendTokens(TokenBuffer& tokens, size_t limit) {
+    try {
+        for (;;) {
+            Token token = nextToken();
+            tokens.push(token);
+            if (token.kind == TokenKind::END_OF_INPUT || token.offset >= limit) break;
+        }
+    } catch (const std::runtime_error& e) {
+        // advance() ya ha consumido el primer carácter del error
+        tokens.errorMessage = e.what();
+        tokens.errorPosition = static_cast<std::uint32_t>(position - 1);
     }
-    
-    // Strings
-    if (ch == '"') {
-        return readString();
+}
+
+void TokenBuffer::push(const Token& token) {
+    const bool end = token.kind == TokenKind::END_OF_INPUT;
+    kinds.push_back(token.kind);
+    offsets.push_back(token.offset);
+    lengths.push_back(static_cast<std::uint32_t>(end ? 0 : token.lexeme.size()));
+    numbers.push_back(token.kind == TokenKind::NUMBER ? token.numberValue : 0.0);
+}
+
+void TokenBuffer::clear() {
+    text = std::string_view();
+    errorPosition = 0;
+    kinds.clear();
+    offsets.clear();
+    lengths.clear();
+    numbers.clear();
+    errorMessage.clear();
+}
+
+// Implementación del LL1Parser
+LL1Parser::LL1Parser(const Grammar& g) : LL1Parser(CompiledGrammar::compile(g)) {}
+
+LL1Parser::LL1Parser(std::shared_ptr<const CompiledGrammar> g)
+    : grammar(std::move(g)), actionByProduction(grammar->productionCount(), nullptr) {
+    // Resolver una sola vez cada clase de token a su ID de terminal en la gramática
+    terminalIdByKind.resize(static_cast<size_t>(TokenKind::COUNT));
+    for (size_t k = 0; k < terminalIdByKind.size(); ++k) {
+        const Symbol& symbol = tokenKindSymbol(static_cast<TokenKind>(k));
+        terminalIdByKind[k] = grammar->findSymbol(symbol.type, symbol.name);
     }
     
-    // Identificadores
-    if (std::isalpha(ch) || ch == '_') {
-        return readIdentifier();
+    // ¿Es el símbolo inicial una lista de sentencias? (inicial -> L; L -> S L | ε)
+    const SymbolId start = grammar->getStartCode();
+    std::vector<int> startProductions;
+    std::vector<int> listProductions;
+    for (size_t p = 0; p < grammar->productionCount(); ++p) {
+        if ((grammar->lhs(int(p)) | NON_TERMINAL_FLAG) == start) startProductions.push_back(int(p));
     }
-    
-    // Operadores de dos caracteres
-    if (ch == ':' && peek(1) == '=') {
-        advance(); advance();
-        return makeToken(Symbol(SymbolType::TERMINAL, "ASSIGN_DESTRUCT"), ":=");
+    if (startProductions.size() != 1 || grammar->rhsLength(startProductions[0]) != 1) return;
+    const SymbolId list = *grammar->rhsBegin(startProductions[0]);
+    if (!(list & NON_TERMINAL_FLAG) || list == start) return;
+    for (size_t p = 0; p < grammar->productionCount(); ++p) {
+        if ((grammar->lhs(int(p)) | NON_TERMINAL_FLAG) == list) listProductions.push_back(int(p));
     }
-    
-    if (ch == '=' && peek(1) == '=') {
-        advance(); advance();
-        return makeToken(Symbol(SymbolType::TERMINAL, "EQ"), "==");
+    if (listProductions.size() != 2) return;
+    
+    size_t empty = 0;
+    size_t recursive = 0;
+    for (int p : listProductions) {
+        const SymbolId* rhs = grammar->rhsBegin(p);
+        if (grammar->rhsLength(p) == 0) ++empty;
+        if (grammar->rhsLength(p) == 2 && (rhs[0] & NON_TERMINAL_FLAG) && rhs[0] != list && rhs[1] == list) ++recursive;
     }
-    
-    if (ch == '!' && peek(1) == '=') {
-        advance(); advance();
-        return makeToken(Symbol(SymbolType::TERMINAL, "NEQ"), "!=");
+    if (empty != 1 || recursive != 1) return;
+    statementListCode = list;
+    
+    // ¿Aparecen las llaves solo como { L }, con '}' en FOLLOW(L) eligiendo L -> ε? Entonces
+    // un bloque con el interior vaciado se analiza igual que con cualquier lista válida
+    const SymbolId open = terminalIdByKind[static_cast<size_t>(TokenKind::LBRACE)];
+    const SymbolId close = terminalIdByKind[static_cast<size_t>(TokenKind::RBRACE)];
+    if (open == INVALID_SYMBOL_ID || close == INVALID_SYMBOL_ID) return;
+    const int emptyList = grammar->predict(list & ~NON_TERMINAL_FLAG, close);
+    if (emptyList < 0 || grammar->rhsLength(emptyList) != 0) return;
+    bool blocks = false;
+    for (size_t p = 0; p < grammar->productionCount(); ++p) {
+        const SymbolId* rhs = grammar->rhsBegin(int(p));
+        const size_t length = grammar->rhsLength(int(p));
+        for (size_t i = 0; i < length; ++i) {
+            if (rhs[i] == open) {
+                if (i + 2 >= length || rhs[i + 1] != list || rhs[i + 2] != close) return;
+                blocks = true;
+            } else if (rhs[i] == close && (i < 2 || rhs[i - 1] != list || rhs[i - 2] != open)) {
+                return;
+            }
+        }
     }
-    
-    if (ch == '<' && peek(1) == '=') {
-        advance(); advance();
-        return makeToken(Symbol(SymbolType::TERMINAL, "LE"), "<=");
+    blockStatements = blocks;
+}
+
+LL1Parser::~LL1Parser() = default;
+
+void LL1Parser::setLexerThreads(unsigned threads) {
+    parallelLexer.reset(threads == 1 ? nullptr : new ParallelLexer(threads));
+}
+
+void LL1Parser::setSemanticAction(int productionId, const SemanticAction& action) {
+    // Los nodos del map no se mueven: la tabla densa puede apuntar a ellos
+    SemanticAction& stored = semanticActions[productionId] = action;
+    if (productionId >= 0 && size_t(productionId) < actionByProduction.size()) {
+        actionByProduction[productionId] = &stored;
     }
-    
-    if (ch == '>' && peek(1) == '=') {
-        advance(); advance();
-        return makeToken(Symbol(SymbolType::TERMINAL, "GE"), ">=");
+}
+
+bool LL1Parser::setGeneratedParser(GeneratedParser entry, std::uint64_t grammarHash,
+                                   GeneratedNonTerminalParser fromNonTerminal) {
+    if ((entry || fromNonTerminal) && grammarHash != grammar->getGrammarHash()) {
+        return false;
     }
-    
-    if (ch == '&' && peek(1) == '&') {
-        advance(); advance();
-        return makeToken(Symbol(SymbolType::TERMINAL, "AND"), "&&");
+    generatedParser = entry;
+    generatedFrom = entry ? fromNonTerminal : nullptr;
+    return true;
+}
+
+SemanticAction* LL1Parser::getSemanticAction(int productionId) {
+    auto it = semanticActions.find(productionId);
+    if (it != semanticActions.end()) {
+        return &it->second;
     }
-    
-    if (ch == '|' && peek(1) == '|') {
-        advance(); advance();
-        return makeToken(Symbol(SymbolType::TERMINAL, "OR"), "||");
+    return nullptr;
+}
+
+std::unique_ptr<ParseSession> LL1Parser::acquireSession() const {
+    {
+        std::lock_guard<std::mutex> lock(sessionMutex);
+        if (!idleSessions.empty()) {
+            std::unique_ptr<ParseSession> session = std::move(idleSessions.back());
+            idleSessions.pop_back();
+            return session;
+        }
     }
-    
-    if (ch == '@' && peek(1) == '@') {
-        advance(); advance();
-        return makeToken(Symbol(SymbolType::TERMINAL, "CONCAT"), "@@");
+    return std::unique_ptr<ParseSession>(new ParseSession(*this));
+}
+
+void LL1Parser::releaseSession(std::unique_ptr<ParseSession> session) const {
+    session->reset();
+    std::lock_guard<std::mutex> lock(sessionMutex);
+    idleSessions.push_back(std::move(session));
+}
+
+std::unique_ptr<Program> LL1Parser::parse(const std::string& input) const {
+    return parseText(input, std::string_view());
+}
+
+std::unique_ptr<Program> LL1Parser::parseFile(const std::string& path) const {
+    MappedFile file(path, true);
+    if (!file.isOpen()) {
+        std::cerr << path << ": Cannot read file: " << file.error() << std::endl;
+        return nullptr;
     }
     
-    if (ch == '=' && peek(1) == '>') {
-        advance(); advance();
-        return makeToken(Symbol(SymbolType::TERMINAL, "ARROW"), "=>");
+    return parseText(std::string_view(file.data(), file.size()), path);
+}
+
+std::unique_ptr<Program> LL1Parser::parseText(std::string_view input, std::string_view sourceName) const {
+    SessionLease session(*this);
+    return parseText(*session.session, input, sourceName, true);
+}
+
+// Sin `parallel` (parseMany ya reparte entradas entre hilos) no se usan ni el
+// ParallelLexer ni el análisis de sentencias en paralelo
+std::unique_ptr<Program> LL1Parser::parseText(ParseSession& session, std::string_view input,
+                                              std::string_view sourceName, bool parallel) const {
+    std::unique_lock<std::mutex> lexerLock(parallelLexerMutex, std::defer_lock);
+    if (parallel && parallelLexer && lexerLock.try_lock()) {
+        parallelLexer->tokenize(input, session.tokenBuffer);
+        lexerLock.unlock();
+    } else {
+        Lexer lexer(input);
+        if (structuralIndex) lexer.useStructuralIndex();
+        lexer.tokenizeAll(session.tokenBuffer);
     }
     
-    // Operadores de un carácter
-    advance();
-    switch (ch) {
-        case '+': return makeToken(Symbol(SymbolType::TERMINAL, "PLUS"));
-        case '-': return makeToken(Symbol(SymbolType::TERMINAL, "MINUS"));
-        case '*': return makeToken(Symbol(SymbolType::TERMINAL, "MULT"));
-        case '/': return makeToken(Symbol(SymbolType::TERMINAL, "DIV"));
-        case '%': return makeToken(Symbol(SymbolType::TERMINAL, "MOD"));
-        case '^': return makeToken(Symbol(SymbolType::TERMINAL, "POW"));
-        case '<': return makeToken(Symbol(SymbolType::TERMINAL, "LESS_THAN"));
-        case '>': return makeToken(Symbol(SymbolType::TERMINAL, "GREATER_THAN"));
-        case '=': return makeToken(Symbol(SymbolType::TERMINAL, "ASSIGN"));
-        case '(': return makeToken(Symbol(SymbolType::TERMINAL, "LPAREN"));
-        case ')': return makeToken(Symbol(SymbolType::TERMINAL, "RPAREN"));
-        case '{': return makeToken(Symbol(SymbolType::TERMINAL, "LBRACE"));
-        case '}': return makeToken(Symbol(SymbolType::TERMINAL, "RBRACE"));
-        case ',': return makeToken(Symbol(SymbolType::TERMINAL, "COMMA"));
-        case ';': return makeToken(Symbol(SymbolType::TERMINAL, "SEMICOLON"));
-        case '.': return makeToken(Symbol(SymbolType::TERMINAL, "DOT"));
-        default:
-            throw std::runtime_error("Unexpected character: " + std::string(1, ch));
+    session.tokens = &session.tokenBuffer;
+    session.nextTokenIndex = 0;
+    session.tokenEnd = session.tokenBuffer.size();
+    session.sourceName = sourceName;
+    if (parallel && statementThreads != 1 && parseStatements(session)) {
+        return session.completeProgram();
     }
+    return session.run();
 }
 
-Token Lexer::peekToken() {
-    size_t oldPos = position;
-    int oldLine = line;
-    int oldCol = column;
-    
-    Token token = nextToken();
-    
-    position = oldPos;
-    line = oldLine;
-    column = oldCol;
-    
-    return token;
+std::unique_ptr<Program> LL1Parser::parse(const TokenBuffer& input) const {
+    SessionLease session(*this);
+    session->tokens = &input;
+    session->nextTokenIndex = 0;
+    session->tokenEnd = input.size();
+    return session->run();
 }
 
-// Implementación del LL1Parser
-void LL1Parser::setSemanticAction(int productionId, const SemanticAction& action) {
-    semanticActions[productionId] = action;
+std::unique_ptr<Program> LL1Parser::parse(InputSource& input, size_t bufferSize) const {
+    StreamingLexer lexer(input, bufferSize);
+    SessionLease session(*this);
+    session->stream = &lexer;
+    return session->run();
 }
 
-SemanticAction* LL1Parser::getSemanticAction(int productionId) {
-    auto it = semanticActions.find(productionId);
-    if (it != semanticActions.end()) {
-        return &it->second;
-    }
-    return nullptr;
+// Implementación de ParseSession
+// Soltar las vistas sobre la entrada (que no sobrevive al análisis) y el AST a medio
+// construir; los buffers conservan su memoria para el siguiente análisis
+void ParseSession::reset() {
+    tokenBuffer.clear();
+    tokens = nullptr;
+    stream = nullptr;
+    nextTokenIndex = 0;
+    tokenEnd = 0;
+    sourceName = std::string_view();
+    output = &std::cout;
+    diagnostics = &std::cerr;
+    currentToken = Token();
+    actionTokens.clear();
+    semanticStack = {};
+    skips.clear();
+    nextSkip = 0;
 }
 
-std::unique_ptr<Program> LL1Parser::parse(const std::string& input) {
-    lexer = std::make_unique<Lexer>(input);
-    advance(); // Leer primer token
-    
+std::unique_ptr<Program> ParseSession::run() {
     try {
-        parseInternal();
+        advance(); // Leer primer token (su error léxico también es un diagnóstico)
         
-        // El resultado debe estar en la cima de la pila semántica
-        if (!semanticStack.empty()) {
-            // Para una implementación completa, aquí deberíamos convertir el nodo semántico a Program
-            auto program = std::make_unique<Program>();
-            std::cout << "✓ Parse completed, created basic program" << std::endl;
-            return program;
+        if (parser.generatedParser) {
+            parseGenerated();
         } else {
-            // Si no hay pila semántica, crear un programa básico
-            auto program = std::make_unique<Program>();
-            std::cout << "✓ Parse completed, created empty program" << std::endl;
-            return program;
+            parseInternal(parser.grammar->getStartCode());
         }
         
+        return completeProgram();
+        
     } catch (const std::exception& e) {
-        std::cerr << "Parse error: " << e.what() << std::endl;
+        report(e);
     }
     
     return nullptr;
 }
 
-void LL1Parser::advance() {
-    if (lexer && lexer->hasMoreTokens()) {
-        currentToken = lexer->nextToken();
+// Diagnóstico de un error en el token actual: "fuente:línea:columna: Parse error: ..."
+void ParseSession::report(const std::exception& error) const {
+    if (!sourceName.empty()) {
+        const SourcePosition position = locate(currentToken.offset);
+        *diagnostics << sourceName << ":" << position.line << ":" << position.column << ": ";
+    }
+    *diagnostics << "Parse error: " << error.what() << std::endl;
+}
+
+// Analizar los tokens [nextTokenIndex, tokenEnd) como `nonTerminal`; lanza si no lo son
+void ParseSession::parseFrom(SymbolId nonTerminal) {
+    nextSkip = 0;
+    advance();
+    if (parser.generatedFrom) {
+        ParseContext context(*this);
+        parser.generatedFrom(context, nonTerminal);
+        checkEndOfInput();
+    } else {
+        parseInternal(nonTerminal | NON_TERMINAL_FLAG);
+    }
+}
+
+std::unique_ptr<Program> ParseSession::completeProgram() {
+    // El resultado debe estar en la cima de la pila semántica
+    if (!semanticStack.empty()) {
+        // Para una implementación completa, aquí deberíamos convertir el nodo semántico a Program
+        auto program = std::make_unique<Program>();
+        if (output) *output << "✓ Parse completed, created basic program" << std::endl;
+        return program;
     } else {
-        currentToken = Token(END_OF_INPUT, "$", currentToken.line, currentToken.column);
+        // Si no hay pila semántica, crear un programa básico
+        auto program = std::make_unique<Program>();
+        if (output) *output << "✓ Parse completed, created empty program" << std::endl;
+        return program;
     }
 }
 
-void LL1Parser::parseInternal() {
-    std::stack<Symbol> parseStack;
+void ParseSession::advance() {
+    if (stream) {
+        currentToken = stream->nextToken();
+    } else if (nextTokenIndex < tokenEnd) {
+        if (nextSkip < skips.size() && nextTokenIndex == skips[nextSkip].first) {
+            nextTokenIndex = skips[nextSkip++].second;
+        }
+        currentToken = tokens->token(nextTokenIndex++);
+    } else if (tokens->hasError() && tokenEnd == tokens->size()) {
+        // Los diagnósticos señalan el carácter que no forma ningún token
+        currentToken.offset = tokens->errorOffset();
+        throw std::runtime_error(tokens->error());
+    } else {
+        currentToken = Token(TokenKind::END_OF_INPUT, "$", currentToken.offset);
+    }
+    currentToken.terminal = parser.terminalIdByKind[static_cast<size_t>(currentToken.kind)];
+}
+
+SymbolId ParseSession::peekTerminal(size_t distance) const {
+    if (distance == 0) return currentToken.terminal;
+    if (stream) {
+        throw std::logic_error("Lookahead beyond the current token needs a TokenBuffer");
+    }
     
-    // Inicializar pila con símbolo inicial
-    parseStack.push(grammar.getStartSymbol());
+    // Más allá del final (o de un error léxico) solo queda END_OF_INPUT
+    const size_t i = nextTokenIndex + distance - 1;
+    const TokenKind kind = i < tokenEnd ? tokens->kind(i) : TokenKind::END_OF_INPUT;
+    return parser.terminalIdByKind[static_cast<size_t>(kind)];
+}
+
+void ParseSession::parseInternal(SymbolId startCode) {
+    const CompiledGrammar& grammar = *parser.grammar;
+    
+    // La pila guarda códigos de símbolo (ID | NON_TERMINAL_FLAG para no terminales) en un
+    // vector contiguo con la cima al final. La sesión se reutiliza entre llamadas, así que
+    // tras el primer análisis ya tiene la capacidad de la mayor profundidad observada.
+    parseStack.clear();
+    parseStack.reserve(INITIAL_PARSE_STACK + grammar.maxRhsLength());
     
-    const auto& parseTable = grammar.getParseTable();
+    // Inicializar pila con símbolo inicial
+    parseStack.push_back(startCode);
     
     while (!parseStack.empty()) {
-        Symbol top = parseStack.top();
-        parseStack.pop();
+        SymbolId top = parseStack.back();
+        parseStack.pop_back();
         
-        if (top.isTerminal()) {
+        if (!(top & NON_TERMINAL_FLAG)) {
             // Coincidencia de terminal
-            if (top.name == currentToken.symbol.name) {
+            if (top == currentToken.terminal) {
                 advance();
             } else {
-                throw std::runtime_error("Expected '" + top.name + "' but found '" + currentToken.lexeme + "'");
+                throwExpected(top);
             }
         }
-        else if (top.isNonTerminal()) {
+        else {
             // Buscar producción en tabla
-            auto key = std::make_pair(top, currentToken.symbol);
-            auto it = parseTable.find(key);
+            SymbolId nonTerminal = top & ~NON_TERMINAL_FLAG;
+            int productionId = grammar.predict(nonTerminal, currentToken.terminal);
             
-            if (it == parseTable.end()) {
-                throw std::runtime_error("No rule for [" + top.name + ", " + currentToken.symbol.name + "]");
+            if (productionId < 0) {
+                throwNoRule(nonTerminal);
             }
             
-            int productionId = it->second;
-            const Production& production = grammar.getProductions()[productionId];
-            
             // Ejecutar acción semántica
-            executeSemanticAction(productionId, production.rhs);
-            
-            // Apilar símbolos en orden inverso (excepto epsilon)
-            if (!production.isEpsilonProduction()) {
-                for (auto it = production.rhs.rbegin(); it != production.rhs.rend(); ++it) {
-                    parseStack.push(*it);
-                }
+            if (const SemanticAction* action = parser.actionByProduction[productionId]) {
+                runSemanticAction(*action);
             }
+            
+            // Apilar el lado derecho ya invertido (sin ε) de una vez
+            parseStack.insert(parseStack.end(), grammar.reversedRhsBegin(productionId), grammar.reversedRhsEnd(productionId));
         }
     }
     
-    // Verificar que hayamos consumido toda la entrada
-    if (!currentToken.symbol.isEndOfInput()) {
-        throw std::runtime_error("Unexpected input after parsing: " + currentToken.lexeme);
-    }
+    checkEndOfInput();
 }
 
-void LL1Parser::executeSemanticAction(int productionId, const std::vector<Symbol>& rhs) {
-    auto it = semanticActions.find(productionId);
-    if (it != semanticActions.end()) {
-        // Crear vector de tokens para la acción semántica
-        std::vector<Token> tokens;
-        tokens.push_back(currentToken); // Token actual
-        
-        it->second(tokens, semanticStack);
+void ParseSession::parseGenerated() {
+    ParseContext context(*this);
+    parser.generatedParser(context);
+    checkEndOfInput();
+}
+
+// Verificar que hayamos consumido toda la entrada
+void ParseSession::checkEndOfInput() const {
+    if (currentToken.kind != TokenKind::END_OF_INPUT) {
+        throw std::runtime_error("Unexpected input after parsing: " + std::string(currentToken.lexeme));
     }
 }
 
-void LL1Parser::reportSyntaxError(const std::string& message) {
-    std::cerr << "Syntax error at line " << currentToken.line 
-              << ", column " << currentToken.column << ": " << message << std::endl;
+void ParseSession::runSemanticAction(const SemanticAction& action) {
+    // Vector de tokens para la acción semántica (se reutiliza: sin reservas por acción)
+    actionTokens.clear();
+    actionTokens.push_back(currentToken); // Token actual
+    
+    action(actionTokens, semanticStack);
 }
 
-std::unique_ptr<Program> LL1Parser::getProgram() {
-    if (!semanticStack.empty()) {
-        // Intentar extraer el Program del stack semántico
-        auto programNode = dynamic_cast<ProgramSemanticNode*>(semanticStack.top().get());
-        if (programNode && programNode->program) {
-            return std::move(programNode->program);
-        }
-    }
-    return std::make_unique<Program>(); // Programa vacío si no hay nada en el stack
+void ParseSession::throwExpected(SymbolId terminal) const {
+    throw std::runtime_error("Expected '" + parser.grammar->getSymbolTable().terminalName(terminal) +
+                             "' but found '" + std::string(currentToken.lexeme) + "'");
+}
+
+void ParseSession::throwNoRule(SymbolId nonTerminal) const {
+    throw std::runtime_error("No rule for [" + parser.grammar->getSymbolTable().nonTerminalName(nonTerminal) +
+                             ", " + currentToken.symbol().name + "]");
+}
+
+// El índice de líneas se construye aquí, solo cuando hay un diagnóstico que dar
+SourcePosition ParseSession::locate(std::uint32_t offset) const {
+    if (stream) return stream->locate(offset);
+    return tokens ? LineIndex(tokens->source()).locate(offset) : SourcePosition();
 }
 
 } // namespace LL1
@@ -1,54 +1,157 @@
 #pragma once
 
 #include "ll1_grammar.hpp"
+#include "ll1_compiled_grammar.hpp"
+#include "ll1_structural_index.hpp"
 #include "../ast.hpp"
 #include <stack>
+#include <string_view>
 #include <functional>
+#include <iostream>
 
 namespace LL1 {
 
-// Token para el analizador léxico
+// Clases de token que reconoce el Lexer (independientes de la gramática)
+enum class TokenKind : std::uint8_t {
+    END_OF_INPUT,
+    NUMBER, STRING, IDENT,
+    // Palabras reservadas
+    LET, IN, IF, ELSE, ELIF, WHILE, FOR, FUNCTION, TYPE, INHERITS, NEW, SELF, BASE, TRUE, FALSE,
+    // Operadores de dos caracteres
+    ASSIGN_DESTRUCT, EQ, NEQ, LE, GE, AND, OR, CONCAT, ARROW,
+    // Operadores y signos de un carácter
+    PLUS, MINUS, MULT, DIV, MOD, POW, LESS_THAN, GREATER_THAN, ASSIGN,
+    LPAREN, RPAREN, LBRACE, RBRACE, COMMA, SEMICOLON, DOT,
+    COUNT
+};
+
+// Símbolo terminal (con el nombre usado en las gramáticas) de cada clase de token
+const Symbol& tokenKindSymbol(TokenKind kind);
+
+// Token para el analizador léxico. No reserva memoria: el lexema es una vista sobre el
+// texto de entrada, que debe seguir vivo mientras se use el token (en LL1Parser::parse,
+// hasta que parse() devuelve). Las acciones semánticas copian lo que quieran conservar.
+// De la posición solo guarda el byte en que empieza; la línea y la columna se calculan
+// cuando hacen falta con un LineIndex sobre el texto.
 struct Token {
-    Symbol symbol;
-    std::string lexeme;
-    int line;
-    int column;
+    TokenKind kind;
+    SymbolId terminal;             // ID del terminal en la gramática, lo resuelve el parser
+    std::uint32_t offset;          // posición del lexema en la entrada del Lexer
+    std::string_view lexeme;
     
-    // Para valores literales
+    // Para valores literales (el Lexer ya convierte los NUMBER: no hace falta volver a
+    // leer el lexema)
     union {
         double numberValue;
         bool boolValue;
     };
-    std::string stringValue;
     
-    Token() : line(0), column(0), numberValue(0.0) {}
-    Token(const Symbol& sym, const std::string& lex, int l = 0, int c = 0)
-        : symbol(sym), lexeme(lex), line(l), column(c), numberValue(0.0) {}
+    Token() : kind(TokenKind::END_OF_INPUT), terminal(INVALID_SYMBOL_ID), offset(0), numberValue(0.0) {}
+    Token(TokenKind k, std::string_view lex, std::uint32_t off = 0)
+        : kind(k), terminal(INVALID_SYMBOL_ID), offset(off), lexeme(lex), numberValue(0.0) {}
+    
+    // Símbolo de la clase de token (su nombre, para diagnósticos)
+    const Symbol& symbol() const { return tokenKindSymbol(kind); }
+    
+    // Contenido de un literal STRING, sin comillas y con los escapes resueltos.
+    // Se construye en cada llamada, solo cuando alguien lo necesita.
+    std::string stringValue() const;
+};
+
+// Todos los tokens de una entrada en estructura de arrays (ver Lexer::tokenizeAll): cada
+// campo es un vector contiguo indexado por la posición del token, que el parser recorre
+// en orden y con lookahead arbitrario sin volver a analizar el texto. Como Token, es una
+// vista sobre la entrada, que debe seguir viva mientras se use el buffer.
+class TokenBuffer {
+    friend class Lexer;
+    friend class ParallelLexer;
+    friend class LL1Parser;
+    
+private:
+    std::string_view text;
+    std::vector<TokenKind> kinds;
+    std::vector<std::uint32_t> offsets;            // posición del lexema en `text`
+    std::vector<std::uint32_t> lengths;
+    std::vector<double> numbers;                   // numberValue (0 si no es NUMBER)
+    std::string errorMessage;                      // error léxico tras el último token
+    std::uint32_t errorPosition = 0;               // y el byte en que se produjo
+    
+public:
+    // Número de tokens, incluido el END_OF_INPUT final (que falta si hubo error)
+    size_t size() const { return kinds.size(); }
+    std::string_view source() const { return text; }
+    
+    TokenKind kind(size_t i) const { return kinds[i]; }
+    std::uint32_t offset(size_t i) const { return offsets[i]; }
+    std::uint32_t length(size_t i) const { return lengths[i]; }
+    double number(size_t i) const { return numbers[i]; }
+    std::string_view lexeme(size_t i) const {
+        return kinds[i] == TokenKind::END_OF_INPUT ? std::string_view("$") : text.substr(offsets[i], lengths[i]);
+    }
+    
+    // Token i completo, como lo habría devuelto Lexer::nextToken
+    Token token(size_t i) const {
+        Token result(kinds[i], lexeme(i), offsets[i]);
+        result.numberValue = numbers[i];
+        return result;
+    }
+    
+    // El análisis léxico se detuvo en un error: el parser lo lanza al llegar a ese punto,
+    // igual que si leyera los tokens uno a uno
+    bool hasError() const { return !errorMessage.empty(); }
+    const std::string& error() const { return errorMessage; }
+    std::uint32_t errorOffset() const { return errorPosition; }
+    
+    // Vacía el buffer conservando la memoria reservada
+    void clear();
+    
+private:
+    void push(const Token& token);
 };
 
-// Analizador léxico simple
+// Analizador léxico: DFA mínimo generado a partir de hulk_tokens.spec (ver
+// hulk_lexer_tables.hpp), con la coincidencia más larga
 class Lexer {
+    friend class ParallelLexer;
+    friend class StreamingLexer;
+    friend class LL1Parser;
+    
 private:
-    std::string input;
-    size_t position;
-    int line;
-    int column;
+    std::string_view input;        // no se copia: el llamador mantiene vivo el texto
+    size_t position;               // sin línea ni columna: se calculan solo en los diagnósticos
+    std::unique_ptr<const StructuralIndex> index;   // primera etapa opcional
+    bool partialInput = false;                      // hay más texto tras `input` (StreamingLexer)
     
 public:
-    Lexer(const std::string& text) : input(text), position(0), line(1), column(1) {}
+    // Las posiciones de los tokens son de 32 bits: la entrada no puede pasar de 4 GiB
+    explicit Lexer(std::string_view text) : Lexer(text, 0) {}
+    
+private:
+    // Empezar a mitad de la entrada (ParallelLexer, StreamingLexer, LL1Parser::reparse),
+    // en la posición indicada
+    Lexer(std::string_view text, size_t start);
+    
+public:
+    
+    // Clasificar antes toda la entrada con SIMD (StructuralIndex) y usar las máscaras
+    // para saltar espacios, identificadores, números y el interior de las cadenas sin
+    // recorrerlos byte a byte. Los tokens son los mismos que sin índice.
+    void useStructuralIndex(StructuralIndex::Isa isa = StructuralIndex::bestIsa());
+    bool usesStructuralIndex() const { return index != nullptr; }
     
     Token nextToken();
     Token peekToken();
+    
+    // Analizar de una vez el resto de la entrada en `tokens` (que se vacía antes). Un
+    // error léxico no se lanza: queda en tokens.error() y termina el buffer.
+    void tokenizeAll(TokenBuffer& tokens);
     bool hasMoreTokens() const { return position < input.size(); }
     
 private:
-    char peek(int offset = 0) const;
     char advance();
-    void skipWhitespace();
-    Token makeToken(const Symbol& symbol, const std::string& lexeme = "");
-    Token readNumber();
-    Token readString();
-    Token readIdentifier();
+    void appendTokens(TokenBuffer& tokens, size_t limit);
+    bool scanToken(Token& token);
+    std::uint8_t scanIndexed(size_t& end) const;
 };
 
 // Base class for AST nodes on semantic stack
@@ -59,19 +162,132 @@ struct SemanticNode {
 // Acciones semánticas para construir el AST
 using SemanticAction = std::function<void(const std::vector<Token>&, std::stack<std::unique_ptr<SemanticNode>>&)>;
 
-// Analizador sintáctico LL(1)
-class LL1Parser {
+class LL1Parser;
+class ParseContext;
+class InputSource;
+class StreamingLexer;
+class IncrementalParse;
+struct TextEdit;
+class ParallelLexer;
+
+// Punto de entrada de un parser descendente recursivo generado (ver CodeGenerator)
+using GeneratedParser = void (*)(ParseContext&);
+
+// Entrada del mismo parser generado a partir de un no terminal cualquiera (su ID)
+using GeneratedNonTerminalParser = void (*)(ParseContext&, SymbolId);
+
+// Estado de un análisis: de dónde salen los tokens, token actual, pilas y buffers de
+// trabajo. Cada llamada a LL1Parser::parse usa una sesión propia (reutilizando las de
+// llamadas anteriores), así que el parser no cambia al analizar y un mismo LL1Parser
+// admite análisis simultáneos desde varios hilos.
+class ParseSession {
+    friend class LL1Parser;
+    friend class ParseContext;
+    
 private:
-    Grammar grammar;
-    std::map<int, SemanticAction> semanticActions;
-    std::unique_ptr<Lexer> lexer;
+    const LL1Parser& parser;
+    TokenBuffer tokenBuffer;                          // tokens de parse(input), reutilizado
+    const TokenBuffer* tokens = nullptr;              // tokens del análisis en curso...
+    StreamingLexer* stream = nullptr;                 // ...o, con parse(InputSource&), su lexer
+    size_t nextTokenIndex = 0;                        // siguiente token de `tokens`
+    size_t tokenEnd = 0;                              // fin de los tokens a analizar (exclusivo)
     Token currentToken;
+    std::vector<Token> actionTokens;                  // argumento de las acciones, reutilizado
+    std::vector<SymbolId> parseStack;                 // pila de parseInternal, reutilizada
+    std::string_view sourceName;                      // archivo de parseFile, para los diagnósticos
+    std::ostream* output = &std::cout;                // aviso de análisis completado (nulo: ninguno)
+    std::ostream* diagnostics = &std::cerr;           // errores de análisis
     
     // Pila para construir el AST
     std::stack<std::unique_ptr<SemanticNode>> semanticStack;
     
+    // Interiores de bloque que advance() se salta (LL1Parser::reparse): pares [primer
+    // token, '}' que lo cierra), en orden
+    std::vector<std::pair<size_t, size_t>> skips;
+    size_t nextSkip = 0;
+    
+    // Capacidad inicial de la pila (más el lado derecho más largo); luego crece sola
+    static constexpr size_t INITIAL_PARSE_STACK = 64;
+    
+    explicit ParseSession(const LL1Parser& owner) : parser(owner) {}
+    
+    std::unique_ptr<Program> run();
+    void parseFrom(SymbolId nonTerminal);
+    std::unique_ptr<Program> completeProgram();
+    void report(const std::exception& error) const;
+    void reset();
+    void advance();
+    SymbolId peekTerminal(size_t distance) const;
+    void parseInternal(SymbolId startCode);
+    void parseGenerated();
+    void checkEndOfInput() const;
+    void runSemanticAction(const SemanticAction& action);
+    SourcePosition locate(std::uint32_t offset) const;
+    [[noreturn]] void throwExpected(SymbolId terminal) const;
+    [[noreturn]] void throwNoRule(SymbolId nonTerminal) const;
+};
+
+// Entrada de LL1Parser::parseMany: un archivo (se mapea en memoria) o un texto del
+// llamador, que debe seguir vivo durante la llamada
+struct ParseSource {
+    std::string name;            // ruta del archivo o nombre del texto para los diagnósticos
+    std::string_view text;
+    bool isFile = false;
+    
+    static ParseSource fromFile(std::string path) { return {std::move(path), {}, true}; }
+    static ParseSource fromText(std::string_view text, std::string name = "") { return {std::move(name), text, false}; }
+};
+
+// Resultado de una entrada de LL1Parser::parseMany
+struct ParseResult {
+    std::unique_ptr<Program> program;   // nulo si la entrada no se pudo leer o analizar
+    std::string diagnostics;            // errores de esta entrada, como los daría parse()
+    double seconds = 0;                 // lectura, análisis léxico y sintáctico
+};
+
+// Analizador sintáctico LL(1). Se configura (acciones semánticas, parser generado,
+// lexer) antes de usarlo; después parse() es const y se puede llamar desde varios hilos
+// a la vez sobre el mismo objeto, compartiendo la gramática y las acciones.
+class LL1Parser {
+    friend class ParseSession;
+    friend class ParseContext;
+    
+private:
+    std::shared_ptr<const CompiledGrammar> grammar;   // compartida, inmutable
+    std::vector<SymbolId> terminalIdByKind;           // TokenKind -> ID de terminal en la gramática
+    std::map<int, SemanticAction> semanticActions;
+    std::vector<const SemanticAction*> actionByProduction;   // las mismas, por ID de producción
+    
+    // Parser generado para esta gramática; si es nulo se usa el intérprete de tabla
+    GeneratedParser generatedParser = nullptr;
+    GeneratedNonTerminalParser generatedFrom = nullptr;
+    bool structuralIndex = false;                     // ver Lexer::useStructuralIndex
+    
+    // Lexer paralelo (con sus hilos) si se pidió en setLexerThreads; lo usa un análisis
+    // a la vez
+    std::unique_ptr<ParallelLexer> parallelLexer;
+    mutable std::mutex parallelLexerMutex;
+    
+    unsigned statementThreads = 1;                    // ver setStatementThreads
+    
+    // Lista de sentencias del nivel superior (inicial -> L; L -> S L | ε), como código de
+    // pila; INVALID_SYMBOL_ID si la gramática no tiene esa forma
+    SymbolId statementListCode = INVALID_SYMBOL_ID;
+    
+    // Las llaves solo aparecen como { L } y L -> ε ante '}': el interior de cada bloque
+    // es una lista de sentencias que reparse puede comprobar aparte
+    bool blockStatements = false;
+    
+    // Sesiones de análisis ya terminados, para reutilizar sus buffers
+    mutable std::mutex sessionMutex;
+    mutable std::vector<std::unique_ptr<ParseSession>> idleSessions;
+    
 public:
-    LL1Parser(const Grammar& g) : grammar(g) {}
+    LL1Parser(const Grammar& g);
+    explicit LL1Parser(std::shared_ptr<const CompiledGrammar> g);
+    ~LL1Parser();
+    
+    const CompiledGrammar& getGrammar() const { return *grammar; }
     
     // Configurar acciones semánticas
     void setSemanticAction(int productionId, const SemanticAction& action);
@@ -79,17 +295,114 @@ public:
     // Obtener acción semántica (para verificar si existe)
     SemanticAction* getSemanticAction(int productionId);
     
-    // Analizar entrada
-    std::unique_ptr<Program> parse(const std::string& input);
+    // Usar un parser descendente recursivo generado en lugar del intérprete de tabla.
+    // Solo se acepta si grammarHash coincide con la gramática del parser; con nullptr
+    // se vuelve al intérprete, que sigue siendo la implementación de referencia.
+    // `fromNonTerminal` (parseFrom en el código generado) sirve para analizar trozos de
+    // la entrada con setStatementThreads; sin él, esos trozos usan el intérprete.
+    bool setGeneratedParser(GeneratedParser entry, std::uint64_t grammarHash,
+                            GeneratedNonTerminalParser fromNonTerminal = nullptr);
+    bool usesGeneratedParser() const { return generatedParser != nullptr; }
+    
+    // Lexer con índice estructural SIMD (para entradas grandes; desactivado por defecto)
+    void setStructuralIndex(bool enabled) { structuralIndex = enabled; }
+    
+    // Análisis léxico en paralelo (ParallelLexer) con `threads` hilos; 1 es secuencial y
+    // 0 usa todos los núcleos. Solo se parten las entradas grandes y, en paralelo, no se
+    // usa el índice estructural. Los hilos se crean una vez y sirven a todos los análisis;
+    // si otro análisis los está usando, el que llega analiza su entrada en secuencia.
+    void setLexerThreads(unsigned threads);
+    
+    // Análisis sintáctico en paralelo de las sentencias del nivel superior con `threads`
+    // hilos (1: secuencial, 0: todos los núcleos). Los tokens se cortan en trozos por
+    // sentencias completas (tras ';' o '}' a profundidad 0 de paréntesis y llaves) y cada
+    // trozo se analiza como una lista de sentencias. Si algún trozo falla se repite el
+    // análisis secuencial, que da los mismos diagnósticos de siempre. Solo se usa con
+    // gramáticas de la forma inicial -> L; L -> S L | ε, sin acciones semánticas (que
+    // dependen del orden) y con entradas grandes.
+    void setStatementThreads(unsigned threads) { statementThreads = threads; }
+    
+    // Analizar entrada: primero se extraen todos los tokens (Lexer::tokenizeAll) y
+    // después se analizan desde el buffer
+    std::unique_ptr<Program> parse(const std::string& input) const;
+    
+    // Analizar un archivo mapeado en memoria (MappedFile, con MADV_SEQUENTIAL), sin
+    // copiarlo: los tokens son vistas sobre el mapeo. Los errores se anotan con
+    // "archivo:línea:columna".
+    std::unique_ptr<Program> parseFile(const std::string& path) const;
+    
+    // Analizar tokens ya extraídos (para medir o reutilizar el análisis léxico aparte)
+    std::unique_ptr<Program> parse(const TokenBuffer& input) const;
     
-    // Obtener el programa AST resultante
-    std::unique_ptr<Program> getProgram();
+    // Analizar leyendo la entrada por partes con un StreamingLexer de `bufferSize` bytes
+    // (StreamingLexer::DEFAULT_BUFFER_SIZE), sin cargarla entera en memoria. Solo hay
+    // lookahead del token actual: ParseContext::peek(k) con k > 0 es un error.
+    std::unique_ptr<Program> parse(InputSource& input, size_t bufferSize = 64 * 1024) const;
+    
+    // Analizar muchas entradas independientes con `threads` hilos (0: todos los núcleos).
+    // Cada hilo usa una sola sesión para todas sus entradas y, al quedarse sin trabajo,
+    // roba la mitad de las pendientes de otro. Los resultados vuelven en el orden de
+    // `sources`; cada entrada se analiza de forma secuencial (sin ParallelLexer) y sus
+    // errores se guardan en su resultado en lugar de ir a std::cerr.
+    std::vector<ParseResult> parseMany(const std::vector<ParseSource>& sources, unsigned threads = 0) const;
+    
+    // Análisis incremental para editores (ver IncrementalParse en ll1_incremental.hpp).
+    // reparse aplica la edición al documento, vuelve a extraer solo los tokens de la
+    // zona editada y a analizar solo las sentencias que cambiaron (las acciones
+    // semánticas solo corren en ellas), y devuelve si el texto resultante es válido.
+    std::unique_ptr<IncrementalParse> parseIncremental(std::string_view text, std::string name = "") const;
+    bool reparse(IncrementalParse& document, const TextEdit& edit) const;
     
 private:
-    void advance();
-    void parseInternal();
-    void executeSemanticAction(int productionId, const std::vector<Symbol>& rhs);
-    void reportSyntaxError(const std::string& message);
+    std::unique_ptr<Program> parseText(std::string_view input, std::string_view sourceName) const;
+    std::unique_ptr<Program> parseText(ParseSession& session, std::string_view input,
+                                       std::string_view sourceName, bool parallel) const;
+    bool parseStatements(ParseSession& session) const;
+    static bool endsStatement(const TokenBuffer& tokens, size_t i, int& depth);
+    
+    std::unique_ptr<ParseSession> acquireSession() const;
+    void releaseSession(std::unique_ptr<ParseSession> session) const;
+    
+    // Sesión de idleSessions (o una nueva) prestada durante una llamada; se devuelve al
+    // terminar, también si el análisis lanza
+    struct SessionLease {
+        const LL1Parser& parser;
+        std::unique_ptr<ParseSession> session;
+        
+        explicit SessionLease(const LL1Parser& owner) : parser(owner), session(owner.acquireSession()) {}
+        ~SessionLease() { parser.releaseSession(std::move(session)); }
+        
+        ParseSession* operator->() const { return session.get(); }
+    };
+};
+
+// Vista de la sesión para el código generado: token actual, consumo de terminales y
+// acciones semánticas (la tabla densa por producción del LL1Parser).
+// Los errores tienen los mismos mensajes que en el intérprete.
+class ParseContext {
+private:
+    ParseSession& session;
+    const std::vector<const SemanticAction*>& actions;
+
+public:
+    explicit ParseContext(ParseSession& s) : session(s), actions(s.parser.actionByProduction) {}
+    
+    SymbolId lookahead() const { return session.currentToken.terminal; }
+    
+    // Terminal `distance` tokens por delante del actual (0 es el actual), sin consumir nada
+    SymbolId peek(size_t distance) const { return session.peekTerminal(distance); }
+    
+    void match(SymbolId terminal) {
+        if (session.currentToken.terminal != terminal) session.throwExpected(terminal);
+        session.advance();
+    }
+    
+    // Producción elegida: ejecuta su acción semántica, como el intérprete al expandir
+    void predict(int productionId) {
+        if (const SemanticAction* action = actions[productionId]) session.runSemanticAction(*action);
+    }
+    
+    [[noreturn]] void noRule(SymbolId nonTerminal) { session.throwNoRule(nonTerminal); }
 };
 
 // Factory para crear analizadores con gramáticas específicas
@@ -125,9 +438,14 @@ public:
     // Crear parser HULK completo V2
     static std::unique_ptr<LL1Parser> createFullHulkParserV2();
     static Grammar createFullHulkGrammarV3();
+    
+    // Gramática V3 compilada una sola vez y compartida por los parsers V3/V4
+    // (sale de las tablas generadas en hulk_v3_tables.hpp mientras estén al día; si no,
+    // se analiza usando la caché binaria indicada por la variable de entorno LL1_GRAMMAR_CACHE)
+    static std::shared_ptr<const CompiledGrammar> getCompiledFullHulkGrammarV3();
     static std::unique_ptr<LL1Parser> createFullHulkParserV3();
     static std::unique_ptr<LL1Parser> createFullHulkParserV4();
-
+    
     // Métodos para acciones semánticas (si se usan)
     // static void setupFullHulkSemanticActions(LL1Parser& parser);
     static void setupFullHulkSemanticActionsV3(LL1Parser& parser);
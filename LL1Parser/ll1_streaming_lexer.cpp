@@ -0,0 +1,85 @@
+#include "ll1_streaming_lexer.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace LL1 {
+
+namespace {
+
+// Avanza `position` sobre los bytes [begin, end)
+void advancePosition(SourcePosition& position, const char* begin, const char* end) {
+    for (const char* newline; (newline = static_cast<const char*>(std::memchr(begin, '\n', end - begin)));) {
+        ++position.line;
+        position.column = 1;
+        begin = newline + 1;
+    }
+    position.column += static_cast<int>(end - begin);
+}
+
+} // namespace
+
+size_t FileDescriptorSource::read(char* data, size_t capacity) {
+    for (;;) {
+        const ssize_t count = ::read(fd, data, capacity);
+        if (count >= 0) return static_cast<size_t>(count);
+        if (errno != EINTR) {
+            throw std::runtime_error(std::string("Read error: ") + std::strerror(errno));
+        }
+    }
+}
+
+size_t StreamSource::read(char* data, size_t capacity) {
+    in.read(data, static_cast<std::streamsize>(capacity));
+    if (in.bad()) {
+        throw std::runtime_error("Read error on input stream");
+    }
+    return static_cast<size_t>(in.gcount());
+}
+
+StreamingLexer::StreamingLexer(InputSource& input, size_t bufferSize)
+    : source(input), buffer(std::max<size_t>(bufferSize, 1)), lexer(std::string_view()) {
+    lexer.partialInput = true;
+}
+
+Token StreamingLexer::nextToken() {
+    Token token;
+    while (!lexer.scanToken(token)) {
+        refill();
+    }
+    return token;
+}
+
+void StreamingLexer::refill() {
+    // Conservar desde el inicio del lexema pendiente; si ocupa todo el buffer, duplicarlo
+    const size_t keep = lexer.position;
+    const size_t live = length - keep;
+    if (keep == 0 && length == buffer.size()) {
+        buffer.resize(buffer.size() * 2);
+    } else if (keep > 0) {
+        advancePosition(bufferStart, buffer.data(), buffer.data() + keep);
+        std::memmove(buffer.data(), buffer.data() + keep, live);
+    }
+    length = live;
+    discarded += keep;
+    
+    const size_t count = source.read(buffer.data() + length, buffer.size() - length);
+    exhausted = count == 0;
+    length += count;
+    
+    // Lexer sobre el buffer nuevo; sin más entrada, lo que queda es final
+    Lexer next(std::string_view(buffer.data(), length), 0);
+    next.partialInput = !exhausted;
+    lexer = std::move(next);
+}
+
+// Solo en los diagnósticos: se cuentan los saltos de línea del buffer hasta el offset
+SourcePosition StreamingLexer::locate(std::uint32_t offset) const {
+    SourcePosition position = bufferStart;
+    advancePosition(position, buffer.data(), buffer.data() + std::min<size_t>(offset, length));
+    return position;
+}
+
+} // namespace LL1
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "ll1_parser.hpp"
+#include <istream>
+
+namespace LL1 {
+
+// Origen de texto para el StreamingLexer: entrega los bytes por partes
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+    
+    // Copia hasta `capacity` bytes en `data`; 0 solo al final de la entrada.
+    // Un error de lectura se lanza como runtime_error.
+    virtual size_t read(char* data, size_t capacity) = 0;
+};
+
+// Descriptor de archivo abierto (archivo, tubería, stdin); no se cierra al terminar
+class FileDescriptorSource : public InputSource {
+private:
+    int fd;
+
+public:
+    explicit FileDescriptorSource(int descriptor) : fd(descriptor) {}
+    size_t read(char* data, size_t capacity) override;
+};
+
+// std::istream (std::cin, std::ifstream, std::istringstream...)
+class StreamSource : public InputSource {
+private:
+    std::istream& in;
+
+public:
+    explicit StreamSource(std::istream& stream) : in(stream) {}
+    size_t read(char* data, size_t capacity) override;
+};
+
+// Lexer sobre un InputSource con un buffer de tamaño fijo que se rellena a medida que se
+// consume, para entradas que no caben (o no se quieren) en memoria. Los tokens son los
+// mismos que con Lexer sobre todo el texto. Un lexema que llega al final del buffer se
+// vuelve a analizar tras rellenarlo; si un solo lexema no cabe, el buffer se duplica,
+// así que la memoria queda acotada por el buffer y el lexema más largo.
+//
+// El lexema de un token es una vista sobre el buffer y su offset es relativo a él: los dos
+// valen hasta la siguiente llamada a nextToken, que puede mover o rellenar el buffer.
+class StreamingLexer {
+public:
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+    
+    explicit StreamingLexer(InputSource& input, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    
+    Token nextToken();
+    
+    size_t bufferCapacity() const { return buffer.size(); }
+    
+    // Bytes de la entrada ya descartados del buffer (desplazamiento del buffer en la entrada)
+    std::uint64_t discardedBytes() const { return discarded; }
+    
+    // Línea y columna en toda la entrada del offset de un token del buffer actual
+    SourcePosition locate(std::uint32_t offset) const;
+
+private:
+    void refill();
+    
+    InputSource& source;
+    std::vector<char> buffer;
+    size_t length = 0;               // bytes válidos en el buffer
+    bool exhausted = false;          // source.read ya devolvió 0
+    std::uint64_t discarded = 0;
+    SourcePosition bufferStart;      // posición de buffer[0] en la entrada
+    Lexer lexer;                     // sobre buffer[0, length)
+};
+
+} // namespace LL1
@@ -0,0 +1,279 @@
+#include "ll1_structural_index.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define LL1_STRUCTURAL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace LL1 {
+
+namespace {
+
+// === Referencia escalar: una tabla de 256 entradas con las clases de cada byte ===
+
+enum ClassBit : std::uint8_t {
+    WHITESPACE = 1 << 0,
+    IDENTIFIER = 1 << 1,
+    DIGIT = 1 << 2,
+    QUOTE = 1 << 3,
+    BACKSLASH = 1 << 4,
+    NUL = 1 << 5,
+    OPERATOR = 1 << 6,
+};
+constexpr unsigned CLASS_COUNT = 7;
+
+constexpr const char* OPERATOR_CHARS = "+-*/%^<>=(){},;.:!&|@";
+
+struct ClassTable {
+    std::uint8_t bits[256] = {};
+    
+    constexpr ClassTable() {
+        for (unsigned c : {' ', '\t', '\n', '\v', '\f', '\r'}) bits[c] |= WHITESPACE;
+        for (unsigned c = '0'; c <= '9'; ++c) bits[c] |= IDENTIFIER | DIGIT;
+        for (unsigned c = 'a'; c <= 'z'; ++c) bits[c] |= IDENTIFIER;
+        for (unsigned c = 'A'; c <= 'Z'; ++c) bits[c] |= IDENTIFIER;
+        bits[unsigned('_')] |= IDENTIFIER;
+        bits[unsigned('"')] |= QUOTE;
+        bits[unsigned('\\')] |= BACKSLASH;
+        bits[0] |= NUL;
+        for (const char* op = OPERATOR_CHARS; *op; ++op) bits[static_cast<unsigned char>(*op)] |= OPERATOR;
+    }
+};
+
+constexpr ClassTable CLASS_TABLE;
+
+// Campos de StructuralBlock en el orden de los bits de ClassBit
+constexpr std::uint64_t StructuralBlock::*BLOCK_FIELDS[] = {
+    &StructuralBlock::whitespace, &StructuralBlock::identifier, &StructuralBlock::digit,
+    &StructuralBlock::quote, &StructuralBlock::backslash, &StructuralBlock::nul,
+    &StructuralBlock::operators,
+};
+
+// Solo los saltos de línea de 64 bytes (para LineIndex, que no necesita el resto)
+std::uint64_t newlineMaskScalar(const char* data) {
+    std::uint64_t mask = 0;
+    for (unsigned i = 0; i < 64; ++i) mask |= std::uint64_t(data[i] == '\n') << i;
+    return mask;
+}
+
+void buildBlockScalar(const char* data, StructuralBlock& block) {
+    std::uint64_t masks[CLASS_COUNT] = {};
+    for (unsigned i = 0; i < 64; ++i) {
+        const std::uint8_t bits = CLASS_TABLE.bits[static_cast<unsigned char>(data[i])];
+        for (unsigned k = 0; k < CLASS_COUNT; ++k) masks[k] |= std::uint64_t((bits >> k) & 1) << i;
+    }
+    for (unsigned k = 0; k < CLASS_COUNT; ++k) block.*BLOCK_FIELDS[k] = masks[k];
+}
+
+#if LL1_STRUCTURAL_X86
+
+// === SSE2: cuatro vectores de 16 bytes por bloque, solo comparaciones ===
+
+#ifdef __SSE2__
+void buildBlockSse2(const char* data, StructuralBlock& block) {
+    block = StructuralBlock();
+    for (unsigned part = 0; part < 4; ++part) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * part));
+        auto eq = [&c](char x) { return _mm_cmpeq_epi8(c, _mm_set1_epi8(x)); };
+        auto between = [](__m128i v, char low, char high) {
+            return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(char(low - 1))),
+                                 _mm_cmplt_epi8(v, _mm_set1_epi8(char(high + 1))));
+        };
+        const unsigned shift = 16 * part;
+        auto put = [shift](std::uint64_t& mask, __m128i v) {
+            mask |= std::uint64_t(unsigned(_mm_movemask_epi8(v)) & 0xFFFF) << shift;
+        };
+        
+        const __m128i digit = between(c, '0', '9');
+        const __m128i letter = between(_mm_or_si128(c, _mm_set1_epi8(0x20)), 'a', 'z');
+        __m128i op = _mm_setzero_si128();
+        for (const char* o = OPERATOR_CHARS; *o; ++o) op = _mm_or_si128(op, eq(*o));
+        
+        put(block.whitespace, _mm_or_si128(eq(' '), between(c, '\t', '\r')));
+        put(block.identifier, _mm_or_si128(_mm_or_si128(digit, letter), eq('_')));
+        put(block.digit, digit);
+        put(block.quote, eq('"'));
+        put(block.backslash, eq('\\'));
+        put(block.nul, eq('\0'));
+        put(block.operators, op);
+    }
+}
+
+std::uint64_t newlineMaskSse2(const char* data) {
+    std::uint64_t mask = 0;
+    for (unsigned part = 0; part < 4; ++part) {
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * part));
+        mask |= std::uint64_t(unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_set1_epi8('\n')))) & 0xFFFF) << (16 * part);
+    }
+    return mask;
+}
+#endif
+
+// === AVX2: dos vectores de 32 bytes por bloque; los operadores se clasifican con dos
+// búsquedas en tablas de 16 entradas (nibble bajo y nibble alto), como en simdjson ===
+
+__attribute__((target("avx2"))) inline __m256i between256(__m256i v, char low, char high) {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(char(low - 1))),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(char(high + 1)), v));
+}
+
+__attribute__((target("avx2"))) inline std::uint64_t movemask256(__m256i v) {
+    return std::uint64_t(std::uint32_t(_mm256_movemask_epi8(v)));
+}
+
+__attribute__((target("avx2"))) void buildBlockAvx2(const char* data, StructuralBlock& block) {
+    // Cada bit de la tabla alta es un nibble alto (2, 3, 4, 5 o 7) y la tabla baja marca,
+    // para cada nibble bajo, con qué nibbles altos forma un operador
+    const __m256i lowTable = _mm256_setr_epi8(
+        0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x13, 0x13, 0x13, 0x0B, 0x01,
+        0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x03, 0x13, 0x13, 0x13, 0x0B, 0x01);
+    const __m256i highTable = _mm256_setr_epi8(
+        0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    
+    block = StructuralBlock();
+    for (unsigned part = 0; part < 2; ++part) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32 * part));
+        const unsigned shift = 32 * part;
+        
+        const __m256i digit = between256(c, '0', '9');
+        const __m256i letter = between256(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), 'a', 'z');
+        const __m256i underscore = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('_'));
+        const __m256i space = _mm256_cmpeq_epi8(c, _mm256_set1_epi8(' '));
+        const __m256i opClass = _mm256_and_si256(
+            _mm256_shuffle_epi8(lowTable, _mm256_and_si256(c, nibble)),
+            _mm256_shuffle_epi8(highTable, _mm256_and_si256(_mm256_srli_epi16(c, 4), nibble)));
+        
+        block.whitespace |= movemask256(_mm256_or_si256(space, between256(c, '\t', '\r'))) << shift;
+        block.identifier |= movemask256(_mm256_or_si256(_mm256_or_si256(digit, letter), underscore)) << shift;
+        block.digit |= movemask256(digit) << shift;
+        block.quote |= movemask256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8('"'))) << shift;
+        block.backslash |= movemask256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8('\\'))) << shift;
+        block.nul |= movemask256(_mm256_cmpeq_epi8(c, _mm256_setzero_si256())) << shift;
+        block.operators |= (~movemask256(_mm256_cmpeq_epi8(opClass, _mm256_setzero_si256())) & 0xFFFFFFFFu) << shift;
+    }
+}
+
+__attribute__((target("avx2"))) std::uint64_t newlineMaskAvx2(const char* data) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+    return movemask256(_mm256_cmpeq_epi8(low, newline)) | movemask256(_mm256_cmpeq_epi8(high, newline)) << 32;
+}
+
+#endif
+
+} // namespace
+
+StructuralIndex::Isa StructuralIndex::bestIsa() {
+    if (isSupported(Isa::AVX2)) return Isa::AVX2;
+    if (isSupported(Isa::SSE2)) return Isa::SSE2;
+    return Isa::SCALAR;
+}
+
+bool StructuralIndex::isSupported(Isa isa) {
+    switch (isa) {
+#if LL1_STRUCTURAL_X86
+#ifdef __SSE2__
+        case Isa::SSE2: return true;
+#endif
+        case Isa::AVX2: return __builtin_cpu_supports("avx2");
+#endif
+        case Isa::SCALAR: return true;
+        default: return false;
+    }
+}
+
+const char* StructuralIndex::isaName(Isa isa) {
+    switch (isa) {
+        case Isa::SSE2: return "sse2";
+        case Isa::AVX2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+StructuralIndex::StructuralIndex(std::string_view text, Isa isa)
+    : length(text.size()), usedIsa(isSupported(isa) ? isa : Isa::SCALAR) {
+    void (*buildBlock)(const char*, StructuralBlock&) = buildBlockScalar;
+#if LL1_STRUCTURAL_X86
+    if (usedIsa == Isa::AVX2) buildBlock = buildBlockAvx2;
+#ifdef __SSE2__
+    if (usedIsa == Isa::SSE2) buildBlock = buildBlockSse2;
+#endif
+#endif
+
+    blockMasks.resize((length + 63) / 64);
+    const size_t fullBlocks = length / 64;
+    for (size_t b = 0; b < fullBlocks; ++b) {
+        buildBlock(text.data() + 64 * b, blockMasks[b]);
+    }
+    
+    // Último bloque incompleto: se completa con ceros y se borran los bits sobrantes
+    if (const size_t rest = length % 64) {
+        char tail[64] = {};
+        std::memcpy(tail, text.data() + 64 * fullBlocks, rest);
+        StructuralBlock& last = blockMasks[fullBlocks];
+        buildBlock(tail, last);
+        const std::uint64_t valid = (std::uint64_t(1) << rest) - 1;
+        for (auto field : BLOCK_FIELDS) last.*field &= valid;
+    }
+}
+
+size_t StructuralIndex::nextClear(std::uint64_t StructuralBlock::*mask, size_t pos) const {
+    for (size_t b = pos / 64; b < blockMasks.size(); ++b) {
+        std::uint64_t clear = ~(blockMasks[b].*mask);
+        if (b == pos / 64) clear &= ~std::uint64_t(0) << (pos % 64);
+        if (clear) return std::min(length, b * 64 + __builtin_ctzll(clear));
+    }
+    return length;
+}
+
+size_t StructuralIndex::findStringSpecial(size_t pos) const {
+    for (size_t b = pos / 64; b < blockMasks.size(); ++b) {
+        const StructuralBlock& block = blockMasks[b];
+        std::uint64_t special = block.quote | block.backslash | block.nul;
+        if (b == pos / 64) special &= ~std::uint64_t(0) << (pos % 64);
+        if (special) return b * 64 + __builtin_ctzll(special);
+    }
+    return length;
+}
+
+LineIndex::LineIndex(std::string_view text, StructuralIndex::Isa isa) {
+    if (!StructuralIndex::isSupported(isa)) isa = StructuralIndex::Isa::SCALAR;
+    std::uint64_t (*newlineMask)(const char*) = newlineMaskScalar;
+#if LL1_STRUCTURAL_X86
+    if (isa == StructuralIndex::Isa::AVX2) newlineMask = newlineMaskAvx2;
+#ifdef __SSE2__
+    if (isa == StructuralIndex::Isa::SSE2) newlineMask = newlineMaskSse2;
+#endif
+#endif
+    
+    // Cada bit de la máscara es un '\n': la línea siguiente empieza justo después
+    lineStarts.push_back(0);
+    auto addLines = [this](std::uint64_t mask, size_t base) {
+        for (; mask; mask &= mask - 1) lineStarts.push_back(base + __builtin_ctzll(mask) + 1);
+    };
+    const size_t fullBlocks = text.size() / 64;
+    for (size_t b = 0; b < fullBlocks; ++b) {
+        addLines(newlineMask(text.data() + 64 * b), 64 * b);
+    }
+    if (const size_t rest = text.size() % 64) {
+        char tail[64] = {};
+        std::memcpy(tail, text.data() + 64 * fullBlocks, rest);
+        addLines(newlineMask(tail), 64 * fullBlocks);
+    }
+}
+
+SourcePosition LineIndex::locate(size_t offset) const {
+    // Última línea que empieza en offset o antes
+    const size_t line = std::upper_bound(lineStarts.begin(), lineStarts.end(), offset) - lineStarts.begin();
+    SourcePosition position;
+    position.line = static_cast<int>(line);
+    position.column = static_cast<int>(offset - lineStarts[line - 1]) + 1;
+    return position;
+}
+
+} // namespace LL1
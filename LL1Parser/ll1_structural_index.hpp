@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace LL1 {
+
+// Máscaras de clases de caracteres de 64 bytes consecutivos de la entrada: el bit i
+// corresponde al byte 64 * bloque + i. Los bits más allá del final del texto son 0.
+struct StructuralBlock {
+    std::uint64_t whitespace = 0;   // ' ' \t \n \v \f \r
+    std::uint64_t identifier = 0;   // [A-Za-z0-9_]
+    std::uint64_t digit = 0;        // [0-9]
+    std::uint64_t quote = 0;        // "
+    std::uint64_t backslash = 0;    // '\'
+    std::uint64_t nul = 0;          // \0 (termina las cadenas)
+    std::uint64_t operators = 0;    // caracteres de operadores y signos: + - * / % ^ < > = ( ) { } , ; . : ! & | @
+};
+
+// Primera etapa opcional del Lexer, al estilo de simdjson: una pasada que clasifica la
+// entrada de 32 o 64 bytes a la vez y deja las máscaras por bloque. Con ellas el Lexer
+// salta espacios, identificadores, dígitos y el interior de las cadenas buscando el
+// siguiente bit en lugar de mirar byte a byte.
+class StructuralIndex {
+public:
+    // Implementación de la pasada; bestIsa() elige en tiempo de ejecución la mejor que
+    // soporta la CPU (SCALAR es la referencia y la única fuera de x86)
+    enum class Isa { SCALAR, SSE2, AVX2 };
+    static Isa bestIsa();
+    static bool isSupported(Isa isa);
+    static const char* isaName(Isa isa);
+    
+    StructuralIndex() = default;
+    explicit StructuralIndex(std::string_view text, Isa isa = bestIsa());
+    
+    size_t size() const { return length; }
+    Isa isa() const { return usedIsa; }
+    const std::vector<StructuralBlock>& blocks() const { return blockMasks; }
+    
+    // Primera posición >= pos que no pertenece a la clase (size() si no hay)
+    size_t skipWhitespace(size_t pos) const { return nextClear(&StructuralBlock::whitespace, pos); }
+    size_t skipIdentifier(size_t pos) const { return nextClear(&StructuralBlock::identifier, pos); }
+    size_t skipDigits(size_t pos) const { return nextClear(&StructuralBlock::digit, pos); }
+    
+    // Primera posición >= pos con '"', '\' o '\0' (size() si no hay)
+    size_t findStringSpecial(size_t pos) const;
+
+private:
+    size_t nextClear(std::uint64_t StructuralBlock::*mask, size_t pos) const;
+    
+    std::vector<StructuralBlock> blockMasks;
+    size_t length = 0;
+    Isa usedIsa = Isa::SCALAR;
+};
+
+// Línea y columna de una posición del texto, desde 1 (la columna cuenta bytes)
+struct SourcePosition {
+    int line = 1;
+    int column = 1;
+};
+
+// Inicio de cada línea de un texto, para pasar posiciones de byte a línea y columna con
+// una búsqueda binaria. Los tokens solo guardan su posición: el índice se construye
+// cuando hace falta (en los diagnósticos), buscando los '\n' de 16 o 32 bytes a la vez.
+class LineIndex {
+public:
+    explicit LineIndex(std::string_view text, StructuralIndex::Isa isa = StructuralIndex::bestIsa());
+    
+    size_t lineCount() const { return lineStarts.size(); }
+    
+    // Posición de un byte del texto (o de su final, offset == size())
+    SourcePosition locate(size_t offset) const;
+
+private:
+    std::vector<size_t> lineStarts;     // lineStarts[0] == 0
+};
+
+} // namespace LL1
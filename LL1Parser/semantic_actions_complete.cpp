@@ -249,15 +249,15 @@ void ParserFactory::setupCompleteSemanticActionsV3(LL1Parser& parser) {
             if (!tokens.empty()) {
                 const Token& token = tokens[0];
                 
-                if (token.symbol.name == "NUMBER") {
-                    double value = std::stod(token.lexeme);
+                if (token.symbol().name == "NUMBER") {
+                    double value = token.numberValue;
                     auto numberExpr = std::make_unique<NumberExpr>(value);
                     stack.push(std::make_unique<ExprSemanticNode>(std::move(numberExpr)));
                     std::cout << "DEBUG: Created NUMBER expression: " << value << std::endl;
                 }
-                else if (token.symbol.name == "STRING") {
+                else if (token.symbol().name == "STRING") {
                     // Remover comillas del string literal
-                    std::string value = token.lexeme;
+                    std::string value(token.lexeme);
                     if (value.length() >= 2 && value[0] == '"' && value.back() == '"') {
                         value = value.substr(1, value.length() - 2);
                     }
@@ -265,18 +265,18 @@ void ParserFactory::setupCompleteSemanticActionsV3(LL1Parser& parser) {
                     stack.push(std::make_unique<ExprSemanticNode>(std::move(stringExpr)));
                     std::cout << "DEBUG: Created STRING expression: " << value << std::endl;
                 }
-                else if (token.symbol.name == "TRUE") {
+                else if (token.symbol().name == "TRUE") {
                     auto boolExpr = std::make_unique<BooleanExpr>(true);
                     stack.push(std::make_unique<ExprSemanticNode>(std::move(boolExpr)));
                     std::cout << "DEBUG: Created TRUE expression" << std::endl;
                 }
-                else if (token.symbol.name == "FALSE") {
+                else if (token.symbol().name == "FALSE") {
                     auto boolExpr = std::make_unique<BooleanExpr>(false);
                     stack.push(std::make_unique<ExprSemanticNode>(std::move(boolExpr)));
                     std::cout << "DEBUG: Created FALSE expression" << std::endl;
                 }
-                else if (token.symbol.name == "IDENT") {
-                    auto varExpr = std::make_unique<VariableExpr>(token.lexeme);
+                else if (token.symbol().name == "IDENT") {
+                    auto varExpr = std::make_unique<VariableExpr>(std::string(token.lexeme));
                     stack.push(std::make_unique<ExprSemanticNode>(std::move(varExpr)));
                     std::cout << "DEBUG: Created VARIABLE expression: " << token.lexeme << std::endl;
                 }
@@ -284,7 +284,7 @@ void ParserFactory::setupCompleteSemanticActionsV3(LL1Parser& parser) {
                     // Fallback para otros tokens
                     auto expr = std::make_unique<NumberExpr>(0);
                     stack.push(std::make_unique<ExprSemanticNode>(std::move(expr)));
-                    std::cout << "DEBUG: Primary expression fallback for token: " << token.symbol.name << std::endl;
+                    std::cout << "DEBUG: Primary expression fallback for token: " << token.symbol().name << std::endl;
                 }
             } else {
                 auto expr = std::make_unique<NumberExpr>(0);
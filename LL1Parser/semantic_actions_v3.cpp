@@ -145,8 +145,8 @@ void ParserFactory::setupFullHulkSemanticActionsV3(LL1Parser& parser) {
     
     // Acción para literales NUMBER
     auto createNumberAction = [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
-        if (!tokens.empty() && tokens[0].symbol.name == "NUMBER") {
-            double value = std::stod(tokens[0].lexeme);
+        if (!tokens.empty() && tokens[0].symbol().name == "NUMBER") {
+            double value = tokens[0].numberValue;
             auto numberExpr = std::make_unique<NumberExpr>(value);
             stack.push(std::make_unique<ExprSemanticNode>(std::move(numberExpr)));
             std::cout << "DEBUG: Created number expr: " << value << std::endl;
@@ -1,4 +1,5 @@
 #include "ll1_parser.hpp"
+#include "hulk_v3_tables.hpp"
 #include "semantic_nodes.hpp"
 #include "../ast.hpp"
 #include <iostream>
@@ -93,10 +94,10 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
     
     using namespace SemanticActionsV4;
     
-    // ==== MAPPING PRECISO DE IDs DE PRODUCCIÓN ====
+    // ==== ACCIONES POR PRODUCCIÓN (constantes generadas en hulk_v3_tables.hpp) ====
     
-    // ID 0: program -> stmt_list
-    parser.setSemanticAction(0, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // program -> stmt_list
+    parser.setSemanticAction(HulkV3::P_PROGRAM__STMT_LIST, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "program->stmt_list");
         
         if (!stack.empty()) {
@@ -110,8 +111,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 1: stmt_list -> stmt stmt_list
-    parser.setSemanticAction(1, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // stmt_list -> stmt stmt_list
+    parser.setSemanticAction(HulkV3::P_STMT_LIST__STMT_STMT_LIST, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "stmt_list->stmt stmt_list");
         
         if (stack.size() >= 2) {
@@ -132,15 +133,15 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 2: stmt_list -> ε
-    parser.setSemanticAction(2, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // stmt_list -> ε
+    parser.setSemanticAction(HulkV3::P_STMT_LIST__EPSILON, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         auto program = std::make_unique<Program>();
         stack.push(std::make_unique<ProgramSemanticNode>(std::move(program)));
         std::cout << "DEBUG: stmt_list epsilon - created empty program" << std::endl;
     });
     
-    // ID 3: stmt -> decl
-    parser.setSemanticAction(3, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // stmt -> decl
+    parser.setSemanticAction(HulkV3::P_STMT__DECL, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "stmt->decl");
         // Pass through - el decl ya debería haber puesto algo útil en el stack
         if (stack.empty()) {
@@ -152,8 +153,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // IDs 4-9: stmt -> expr_type SEMICOLON
-    for (int i = 4; i <= 9; ++i) {
+    // stmt -> expr_type SEMICOLON (let, if, while, for, block y or_expr son consecutivas)
+    for (int i = HulkV3::P_STMT__LET_EXPR_SEMICOLON; i <= HulkV3::P_STMT__OR_EXPR_SEMICOLON; ++i) {
         parser.setSemanticAction(i, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
             printStackInfo(stack, "stmt->expr;");
             
@@ -172,8 +173,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         });
     }
     
-    // ID 10: decl -> function_decl
-    parser.setSemanticAction(10, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // decl -> function_decl
+    parser.setSemanticAction(HulkV3::P_DECL__FUNCTION_DECL, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "decl->function_decl");
         // Pass through - function_decl ya debería haber puesto algo útil en el stack
         if (stack.empty()) {
@@ -185,8 +186,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 11: or_expr -> and_expr or_expr_prime
-    parser.setSemanticAction(11, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // or_expr -> and_expr or_expr_prime
+    parser.setSemanticAction(HulkV3::P_OR_EXPR__AND_EXPR_OR_EXPR_PRIME, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "or_expr->and_expr or_expr_prime");
         
         if (stack.size() >= 2) {
@@ -215,8 +216,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 12: or_expr_prime -> OR and_expr or_expr_prime
-    parser.setSemanticAction(12, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // or_expr_prime -> OR and_expr or_expr_prime
+    parser.setSemanticAction(HulkV3::P_OR_EXPR_PRIME__OR_AND_EXPR_OR_EXPR_PRIME, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "or_expr_prime->OR and_expr or_expr_prime");
         
         if (stack.size() >= 2) {
@@ -241,14 +242,14 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 13: or_expr_prime -> ε
-    parser.setSemanticAction(13, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // or_expr_prime -> ε
+    parser.setSemanticAction(HulkV3::P_OR_EXPR_PRIME__EPSILON, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         pushEpsilonMarker(stack);
         std::cout << "DEBUG: or_expr_prime epsilon - empty marker" << std::endl;
     });
     
-    // Similar para and_expr - ID 14: and_expr -> eq_expr and_expr_prime
-    parser.setSemanticAction(14, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // Similar para and_expr: and_expr -> eq_expr and_expr_prime
+    parser.setSemanticAction(HulkV3::P_AND_EXPR__EQ_EXPR_AND_EXPR_PRIME, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "and_expr->eq_expr and_expr_prime");
         
         if (stack.size() >= 2) {
@@ -273,8 +274,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 15: and_expr_prime -> AND eq_expr and_expr_prime
-    parser.setSemanticAction(15, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // and_expr_prime -> AND eq_expr and_expr_prime
+    parser.setSemanticAction(HulkV3::P_AND_EXPR_PRIME__AND_EQ_EXPR_AND_EXPR_PRIME, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "and_expr_prime->AND eq_expr and_expr_prime");
         
         if (stack.size() >= 2) {
@@ -299,16 +300,16 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 16: and_expr_prime -> ε
-    parser.setSemanticAction(16, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // and_expr_prime -> ε
+    parser.setSemanticAction(HulkV3::P_AND_EXPR_PRIME__EPSILON, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         pushEpsilonMarker(stack);
         std::cout << "DEBUG: and_expr_prime epsilon - empty marker" << std::endl;
     });
     
     // Continuar con más producciones...
     
-    // ID 27: arith_expr -> add_expr (pass through)
-    parser.setSemanticAction(27, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // arith_expr -> add_expr (pass through)
+    parser.setSemanticAction(HulkV3::P_ARITH_EXPR__ADD_EXPR, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "arith_expr->add_expr");
         // Pass through - solo pasar la expresión
         if (stack.empty()) {
@@ -320,8 +321,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 28: add_expr -> mult_expr add_expr_prime
-    parser.setSemanticAction(28, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // add_expr -> mult_expr add_expr_prime
+    parser.setSemanticAction(HulkV3::P_ADD_EXPR__MULT_EXPR_ADD_EXPR_PRIME, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "add_expr->mult_expr add_expr_prime");
         
         if (stack.size() >= 2) {
@@ -348,8 +349,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 29: add_expr_prime -> PLUS mult_expr add_expr_prime
-    parser.setSemanticAction(29, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // add_expr_prime -> PLUS mult_expr add_expr_prime
+    parser.setSemanticAction(HulkV3::P_ADD_EXPR_PRIME__PLUS_MULT_EXPR_ADD_EXPR_PRIME, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "add_expr_prime->PLUS mult_expr add_expr_prime");
         
         if (stack.size() >= 2) {
@@ -374,8 +375,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 30: add_expr_prime -> MINUS mult_expr add_expr_prime
-    parser.setSemanticAction(30, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // add_expr_prime -> MINUS mult_expr add_expr_prime
+    parser.setSemanticAction(HulkV3::P_ADD_EXPR_PRIME__MINUS_MULT_EXPR_ADD_EXPR_PRIME, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "add_expr_prime->MINUS mult_expr add_expr_prime");
         
         if (stack.size() >= 2) {
@@ -400,14 +401,14 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 31: add_expr_prime -> ε
-    parser.setSemanticAction(31, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // add_expr_prime -> ε
+    parser.setSemanticAction(HulkV3::P_ADD_EXPR_PRIME__EPSILON, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         pushEpsilonMarker(stack);
         std::cout << "DEBUG: add_expr_prime epsilon - empty marker" << std::endl;
     });
     
-    // ID 32: mult_expr -> primary_expr mult_expr_prime
-    parser.setSemanticAction(32, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // mult_expr -> primary_expr mult_expr_prime
+    parser.setSemanticAction(HulkV3::P_MULT_EXPR__PRIMARY_EXPR_MULT_EXPR_PRIME, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "mult_expr->primary_expr mult_expr_prime");
         
         if (stack.size() >= 2) {
@@ -433,18 +434,18 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 36: mult_expr_prime -> ε
-    parser.setSemanticAction(36, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // mult_expr_prime -> ε
+    parser.setSemanticAction(HulkV3::P_MULT_EXPR_PRIME__EPSILON, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         pushEpsilonMarker(stack);
         std::cout << "DEBUG: mult_expr_prime epsilon - empty marker" << std::endl;
     });
     
     // === PRODUCCIONES CLAVE PARA LITERALES ===
     
-    // ID 37: primary_expr -> NUMBER
-    parser.setSemanticAction(37, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // primary_expr -> NUMBER
+    parser.setSemanticAction(HulkV3::P_PRIMARY_EXPR__NUMBER, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         if (!tokens.empty()) {
-            double value = std::stod(tokens[0].lexeme);
+            double value = tokens[0].numberValue;
             auto numberExpr = std::make_unique<NumberExpr>(value);
             stack.push(std::make_unique<ExprSemanticNode>(std::move(numberExpr)));
             std::cout << "DEBUG: Created NUMBER expression: " << value << std::endl;
@@ -455,10 +456,10 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 38: primary_expr -> STRING
-    parser.setSemanticAction(38, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // primary_expr -> STRING
+    parser.setSemanticAction(HulkV3::P_PRIMARY_EXPR__STRING, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         if (!tokens.empty()) {
-            std::string value = tokens[0].lexeme;
+            std::string value(tokens[0].lexeme);
             if (value.length() >= 2 && value[0] == '"' && value.back() == '"') {
                 value = value.substr(1, value.length() - 2);
             }
@@ -472,24 +473,24 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 39: primary_expr -> TRUE
-    parser.setSemanticAction(39, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // primary_expr -> TRUE
+    parser.setSemanticAction(HulkV3::P_PRIMARY_EXPR__TRUE, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         auto boolExpr = std::make_unique<BooleanExpr>(true);
         stack.push(std::make_unique<ExprSemanticNode>(std::move(boolExpr)));
         std::cout << "DEBUG: Created TRUE expression" << std::endl;
     });
     
-    // ID 40: primary_expr -> FALSE
-    parser.setSemanticAction(40, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // primary_expr -> FALSE
+    parser.setSemanticAction(HulkV3::P_PRIMARY_EXPR__FALSE, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         auto boolExpr = std::make_unique<BooleanExpr>(false);
         stack.push(std::make_unique<ExprSemanticNode>(std::move(boolExpr)));
         std::cout << "DEBUG: Created FALSE expression" << std::endl;
     });
     
-    // ID 41: primary_expr -> IDENT ident_suffix
-    parser.setSemanticAction(41, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // primary_expr -> IDENT ident_suffix
+    parser.setSemanticAction(HulkV3::P_PRIMARY_EXPR__IDENT_IDENT_SUFFIX, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         if (!tokens.empty()) {
-            std::string varName = tokens[0].lexeme;
+            std::string varName(tokens[0].lexeme);
             auto varExpr = std::make_unique<VariableExpr>(varName);
             stack.push(std::make_unique<ExprSemanticNode>(std::move(varExpr)));
             std::cout << "DEBUG: Created VARIABLE expression: " << varName << std::endl;
@@ -500,8 +501,8 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 42: primary_expr -> LPAREN or_expr RPAREN
-    parser.setSemanticAction(42, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // primary_expr -> LPAREN or_expr RPAREN
+    parser.setSemanticAction(HulkV3::P_PRIMARY_EXPR__LPAREN_OR_EXPR_RPAREN, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         printStackInfo(stack, "primary_expr->LPAREN or_expr RPAREN");
         
         if (!stack.empty()) {
@@ -514,14 +515,14 @@ void ParserFactory::setupCompleteSemanticActionsV4(LL1Parser& parser) {
         }
     });
     
-    // ID 45: ident_suffix -> ε
-    parser.setSemanticAction(45, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+    // ident_suffix -> ε
+    parser.setSemanticAction(HulkV3::P_IDENT_SUFFIX__EPSILON, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
         pushEpsilonMarker(stack);
         std::cout << "DEBUG: ident_suffix epsilon - empty marker" << std::endl;
     });
     
     // Acciones por defecto para producciones no implementadas
-    for (int i = 0; i < 100; ++i) {
+    for (int i = 0; i < HulkV3::PRODUCTION_COUNT; ++i) {
         // Solo configurar si no está ya configurado
         if (parser.getSemanticAction(i) == nullptr) {
             parser.setSemanticAction(i, [](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
@@ -87,7 +87,8 @@ void ParserFactory::setupSimpleHulkSemanticActions(LL1Parser& parser) {
 }
 
 std::unique_ptr<LL1Parser> ParserFactory::createSimpleHulkParser() {
-    Grammar grammar = createSimpleHulkGrammar();
+    // La gramática se analiza una sola vez y se comparte entre todos los parsers
+    static const auto grammar = CompiledGrammar::compile(createSimpleHulkGrammar());
     auto parser = std::make_unique<LL1Parser>(grammar);
     setupSimpleHulkSemanticActions(*parser);
     return parser;
@@ -0,0 +1,209 @@
+#include "ll1_grammar.hpp"
+#include "ll1_parser.hpp"
+#include <iostream>
+#include <sstream>
+#include <cassert>
+
+using namespace LL1;
+
+// Resultado observable de un análisis: éxito, salida y secuencia de producciones aplicadas
+struct ParseTrace {
+    bool success = false;
+    std::string output;
+    std::vector<std::string> actions;
+};
+
+// Forward declarations
+ParseTrace runParser(LL1Parser& parser, const std::string& input, bool preTokenized = false);
+void testGeneratedParserIsInstalled();
+void testGeneratedMatchesInterpreter();
+void testPreTokenizedInput();
+
+// Corpus: entradas de la gramática V3, aceptadas y rechazadas (errores de distintos tipos)
+const std::vector<std::string> CORPUS = {
+    "123;",
+    "42.5;",
+    "\"hello world\";",
+    "true; false;",
+    "x + y * z;",
+    "(10 + 20) * 3 / 4 % 5;",
+    "a + b - c + d - e;",
+    "1 < 2 && 3 >= 4 || 5 != 6;",
+    "1 < 2 & 3;",
+    "x == y;",
+    "f(1, 2, g(3));",
+    "f();",
+    "new Point(1, 2);",
+    "let x = 5 in x + 1;",
+    "let a = 1, b = 2, c = a + b in c * 2;",
+    "let x := 5 in x + 1;",
+    "let a := 1, b := a in { a; b; };",
+    "if (x > 0) 1 elif (x < 0) 2 else 3;",
+    "if (ok) x;",
+    "while (i < 10) { i; };",
+    "for (i in range(1, 10)) i * 2;",
+    "{ 1; 2; { 3; }; };",
+    "function f(a, b) => a + b;",
+    "function g() { let x = 1 in x; }",
+    "function h(x) => x; h(1); h(2);",
+    "",
+    // Errores
+    "123",
+    "1 + ;",
+    "let x 5 in x;",
+    "if (x 1;",
+    "f(1, 2;",
+    "function (a) => a;",
+    "{ 1; ",
+    "1; )",
+    "x = 3;",
+};
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Generated Recursive Descent Parser" << std::endl;
+    std::cout << "================================================================" << std::endl << std::endl;
+
+    try {
+        testGeneratedParserIsInstalled();
+        testGeneratedMatchesInterpreter();
+        testPreTokenizedInput();
+        std::cout << "All tests passed! ✓" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Con preTokenized, los tokens se extraen antes con Lexer::tokenizeAll y se analiza el buffer
+ParseTrace runParser(LL1Parser& parser, const std::string& input, bool preTokenized) {
+    ParseTrace trace;
+
+    // Acción de registro en todas las producciones: producción y token actual
+    const size_t productionCount = parser.getGrammar().getProductions().size();
+    for (size_t p = 0; p < productionCount; ++p) {
+        parser.setSemanticAction(int(p), [&trace, p](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>&) {
+            trace.actions.push_back(std::to_string(p) + ":" + std::string(tokens[0].lexeme));
+        });
+    }
+
+    // Capturar la salida (mensajes de éxito y de error) del análisis
+    std::ostringstream captured;
+    std::streambuf* oldOut = std::cout.rdbuf(captured.rdbuf());
+    std::streambuf* oldErr = std::cerr.rdbuf(captured.rdbuf());
+    if (preTokenized) {
+        TokenBuffer tokens;
+        Lexer(input).tokenizeAll(tokens);
+        trace.success = parser.parse(tokens) != nullptr;
+    } else {
+        trace.success = parser.parse(input) != nullptr;
+    }
+    std::cout.rdbuf(oldOut);
+    std::cerr.rdbuf(oldErr);
+
+    trace.output = captured.str();
+    return trace;
+}
+
+void testGeneratedParserIsInstalled() {
+    std::cout << "=== Test: V3 factory installs the generated parser ===" << std::endl;
+
+    auto parser = ParserFactory::createFullHulkParserV3();
+    assert(parser->usesGeneratedParser());
+
+    // Un parser generado para otra gramática se rechaza
+    GeneratedParser other = [](ParseContext&) {};
+    assert(!parser->setGeneratedParser(other, parser->getGrammar().getGrammarHash() ^ 1));
+    assert(parser->usesGeneratedParser());
+
+    // nullptr vuelve al intérprete
+    assert(parser->setGeneratedParser(nullptr, 0));
+    assert(!parser->usesGeneratedParser());
+
+    std::cout << "✓ Generated parser installed and guarded by the grammar hash\n" << std::endl;
+}
+
+void testGeneratedMatchesInterpreter() {
+    std::cout << "=== Test: Generated parser matches the table interpreter ===" << std::endl;
+
+    auto generated = ParserFactory::createFullHulkParserV3();
+    auto interpreter = ParserFactory::createFullHulkParserV3();
+    interpreter->setGeneratedParser(nullptr, 0);
+
+    int failures = 0;
+    for (const auto& input : CORPUS) {
+        ParseTrace expected = runParser(*interpreter, input);
+        ParseTrace actual = runParser(*generated, input);
+
+        bool same = expected.success == actual.success && expected.output == actual.output &&
+                    expected.actions == actual.actions;
+        std::cout << (same ? "✓ " : "✗ ") << "\"" << input << "\" -> "
+                  << (expected.success ? "accepted" : "rejected") << ", "
+                  << expected.actions.size() << " productions" << std::endl;
+        if (!same) {
+            std::cout << "  interpreter: " << expected.output;
+            std::cout << "  generated:   " << actual.output;
+            ++failures;
+        }
+    }
+
+    if (failures > 0) {
+        throw std::runtime_error(std::to_string(failures) + " inputs differ between parsers");
+    }
+
+    std::cout << "✓ Same productions, tokens and diagnostics on every input\n" << std::endl;
+}
+
+// Terminales vistos por el parser de prueba de lookahead: peek(0..3) antes de consumir
+// y después lookahead() tras cada match
+static std::vector<SymbolId> peeked;
+static std::vector<SymbolId> matched;
+
+void testPreTokenizedInput() {
+    std::cout << "=== Test: Parsing from a pre-tokenized buffer ===" << std::endl;
+
+    // Mismo resultado analizando el texto o el buffer de tokens, con ambos parsers
+    auto generated = ParserFactory::createFullHulkParserV3();
+    auto interpreter = ParserFactory::createFullHulkParserV3();
+    interpreter->setGeneratedParser(nullptr, 0);
+    for (LL1Parser* parser : {generated.get(), interpreter.get()}) {
+        for (const auto& input : CORPUS) {
+            ParseTrace expected = runParser(*parser, input);
+            ParseTrace actual = runParser(*parser, input, true);
+            assert(expected.success == actual.success);
+            assert(expected.output == actual.output);
+            assert(expected.actions == actual.actions);
+        }
+    }
+
+    // Lookahead arbitrario desde el código generado: peek(k) es el terminal que
+    // lookahead() devuelve tras k coincidencias, también más allá del final
+    GeneratedParser lookahead = [](ParseContext& context) {
+        for (size_t k = 0; k < 4; ++k) peeked.push_back(context.peek(k));
+        for (size_t k = 0; k < 3; ++k) {
+            context.match(context.lookahead());
+            matched.push_back(context.lookahead());
+        }
+    };
+    auto parser = ParserFactory::createFullHulkParserV3();
+    assert(parser->setGeneratedParser(lookahead, parser->getGrammar().getGrammarHash()));
+
+    std::ostringstream captured;
+    std::streambuf* oldOut = std::cout.rdbuf(captured.rdbuf());
+    bool accepted = parser->parse("x + 1") != nullptr;
+    std::cout.rdbuf(oldOut);
+    assert(accepted);
+    assert(peeked.size() == 4 && matched.size() == 3);
+    assert(peeked[0] != peeked[1] && peeked[1] != peeked[2]);
+    for (size_t k = 0; k < 3; ++k) assert(peeked[k + 1] == matched[k]);
+
+    // Un error léxico se lanza al llegar a ese token, no antes
+    TokenBuffer tokens;
+    Lexer("1 + & 2").tokenizeAll(tokens);
+    assert(tokens.size() == 2 && tokens.hasError());
+    assert(tokens.error() == "Unexpected character: &");
+
+    std::cout << "✓ Same parses from the buffer, lookahead without re-lexing\n" << std::endl;
+}
@@ -0,0 +1,195 @@
+#include "ll1_grammar.hpp"
+#include "ll1_parser.hpp"
+#include "ll1_codegen.hpp"
+#include "hulk_v3_tables.hpp"
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <set>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+using namespace LL1;
+
+// Forward declarations
+void assertSameGrammar(const CompiledGrammar& expected, const CompiledGrammar& actual);
+void testCacheRoundTrip(const std::string& path);
+void testCacheFallback(const std::string& path);
+void testGeneratedTables();
+void testGeneratedNames();
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Compiled Grammar Cache" << std::endl;
+    std::cout << "=====================================================" << std::endl << std::endl;
+
+    const std::string path = "grammar_v3_test.cache";
+
+    try {
+        testCacheRoundTrip(path);
+        testCacheFallback(path);
+        testGeneratedTables();
+        testGeneratedNames();
+        std::remove(path.c_str());
+        std::cout << "All tests passed! ✓" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        std::remove(path.c_str());
+        return 1;
+    }
+
+    return 0;
+}
+
+void assertSameGrammar(const CompiledGrammar& expected, const CompiledGrammar& actual) {
+    const SymbolTable& a = expected.getSymbolTable();
+    const SymbolTable& b = actual.getSymbolTable();
+    assert(a.terminalCount() == b.terminalCount());
+    assert(a.nonTerminalCount() == b.nonTerminalCount());
+    assert(expected.getStartCode() == actual.getStartCode());
+    assert(expected.isLL1() == actual.isLL1());
+    for (SymbolId n = 0; n < a.nonTerminalCount(); ++n) {
+        for (SymbolId t = 0; t < a.terminalCount(); ++t) {
+            assert(expected.predict(n, t) == actual.predict(n, t));
+        }
+    }
+
+    assert(expected.maxRhsLength() == actual.maxRhsLength());
+    for (size_t p = 0; p < expected.getProductions().size(); ++p) {
+        assert(expected.getProductions()[p].toString() == actual.getProductions()[p].toString());
+
+        // Lado derecho invertido que apila el parser, derivado también al cargar
+        std::vector<SymbolId> reversed(actual.rhsBegin(int(p)), actual.rhsEnd(int(p)));
+        std::reverse(reversed.begin(), reversed.end());
+        assert(std::equal(reversed.begin(), reversed.end(), actual.reversedRhsBegin(int(p)), actual.reversedRhsEnd(int(p))));
+        assert(actual.rhsLength(int(p)) <= actual.maxRhsLength());
+    }
+
+    for (SymbolId t = 0; t < a.terminalCount(); ++t) {
+        assert(a.terminalName(t) == b.terminalName(t));
+        assert(actual.findSymbol(t == END_OF_INPUT_ID ? SymbolType::END_OF_INPUT : SymbolType::TERMINAL, a.terminalName(t)) == t);
+    }
+    for (SymbolId n = 0; n < a.nonTerminalCount(); ++n) {
+        assert(a.nonTerminalName(n) == b.nonTerminalName(n));
+        assert(actual.findSymbol(SymbolType::NON_TERMINAL, a.nonTerminalName(n)) == n);
+        assert(expected.first(n).isNullable() == actual.first(n).isNullable());
+        for (SymbolId t = 0; t < a.terminalCount(); ++t) {
+            assert(expected.first(n).contains(t) == actual.first(n).contains(t));
+            assert(expected.follow(n).contains(t) == actual.follow(n).contains(t));
+        }
+    }
+}
+
+void testCacheRoundTrip(const std::string& path) {
+    std::cout << "=== Test: Save and load compiled V3 grammar ===" << std::endl;
+
+    auto compiled = CompiledGrammar::compile(ParserFactory::createFullHulkGrammarV3());
+    assert(compiled->save(path));
+
+    auto loaded = CompiledGrammar::load(path, compiled->getGrammarHash());
+    assert(loaded);
+
+    // La gramática apunta al archivo mapeado, que sigue vivo aunque se borre del disco
+    std::remove(path.c_str());
+    assertSameGrammar(*compiled, *loaded);
+    assert(compiled->save(path));
+
+    // Un archivo truncado no se carga
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out(path + ".cut", std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), std::streamsize(bytes.size() - 8));
+    }
+    assert(!CompiledGrammar::load(path + ".cut", compiled->getGrammarHash()));
+    std::remove((path + ".cut").c_str());
+
+    std::cout << "✓ Loaded grammar matches the freshly compiled one\n" << std::endl;
+}
+
+void testCacheFallback(const std::string& path) {
+    std::cout << "=== Test: Stale cache falls back to recomputation ===" << std::endl;
+
+    // Otra gramática: el hash no coincide con la caché de V3
+    Grammar grammar = ParserFactory::createSimpleHulkGrammar();
+    assert(!CompiledGrammar::load(path, grammar.contentHash()));
+
+    auto compiled = CompiledGrammar::compileCached(grammar, path);
+    assert(compiled->getGrammarHash() == grammar.contentHash());
+
+    // La caché se reescribió para la nueva gramática
+    auto reloaded = CompiledGrammar::load(path, grammar.contentHash());
+    assert(reloaded);
+    assertSameGrammar(*compiled, *reloaded);
+
+    std::cout << "✓ Stale cache was rebuilt\n" << std::endl;
+}
+
+void testGeneratedTables() {
+    std::cout << "=== Test: Generated V3 tables match the analyzed grammar ===" << std::endl;
+
+    // Las constantes generadas se pueden consultar en tiempo de compilación
+    static_assert(HulkV3::predict(HulkV3::NT_PRIMARY_EXPR, HulkV3::T_NUMBER) == HulkV3::P_PRIMARY_EXPR__NUMBER,
+                  "primary_expr predicts its NUMBER production on NUMBER");
+    static_assert(HulkV3::predict(HulkV3::NT_PRIMARY_EXPR, HulkV3::T_SEMICOLON) == -1,
+                  "primary_expr cannot start with SEMICOLON");
+
+    Grammar grammar = ParserFactory::createFullHulkGrammarV3();
+    assert(grammar.contentHash() == HulkV3::GRAMMAR_HASH);
+
+    auto generated = HulkV3::compiledGrammar();
+    assert(generated);
+    assertSameGrammar(*CompiledGrammar::compile(grammar), *generated);
+
+    // La fábrica comparte la gramática construida desde las tablas generadas
+    assert(ParserFactory::getCompiledFullHulkGrammarV3() == generated);
+
+    // Tablas inconsistentes se rechazan antes de que el parser las use
+    GrammarTables broken = HulkV3::TABLES;
+    broken.startCode = HulkV3::T_NUMBER;
+    assert(!CompiledGrammar::fromTables(broken));
+    std::vector<SymbolId> reversed(HulkV3::RHS_CODES, HulkV3::RHS_CODES + HulkV3::RHS_CODE_COUNT);
+    broken = HulkV3::TABLES;
+    broken.reversedRhsCodes = reversed.data();
+    assert(!CompiledGrammar::fromTables(broken));
+
+    std::cout << "✓ Generated tables match the freshly compiled grammar\n" << std::endl;
+}
+
+void testGeneratedNames() {
+    std::cout << "=== Test: Generated names for arbitrary symbol names ===" << std::endl;
+
+    // Nombres que se sanean igual, que chocan con T_END_OF_INPUT o que no caben tal cual
+    // en un literal o un comentario
+    auto N = [](const char* name) { return Symbol(SymbolType::NON_TERMINAL, name); };
+    auto T = [](const char* name) { return Symbol(SymbolType::TERMINAL, name); };
+    Grammar grammar;
+    grammar.setStartSymbol(N("s"));
+    grammar.addProduction(N("s"), {T("a-b"), N("s-x")});
+    grammar.addProduction(N("s"), {T("a_b"), N("s_x")});
+    grammar.addProduction(N("s"), {T("end of input"), T("\"q\\"), T("*/\n")});
+    grammar.addProduction(N("s-x"), {T("é")});
+    grammar.addProduction(N("s_x"), {EPSILON});
+    auto compiled = CompiledGrammar::compile(grammar);
+
+    for (const auto& names : {CodeGenerator::terminalConstants(*compiled), CodeGenerator::nonTerminalConstants(*compiled),
+                              CodeGenerator::productionConstants(*compiled), CodeGenerator::parseFunctionNames(*compiled)}) {
+        assert(std::set<std::string>(names.begin(), names.end()).size() == names.size());
+        for (const std::string& name : names) {
+            assert(std::all_of(name.begin(), name.end(), [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; }));
+        }
+    }
+    assert(CodeGenerator::terminalConstants(*compiled)[END_OF_INPUT_ID] == "T_END_OF_INPUT");
+
+    // Los nombres originales aparecen escapados en los literales
+    std::ostringstream header;
+    CodeGenerator::writeTablesHeader(*compiled, "Names", "test", header);
+    assert(header.str().find("\"\\\"q\\\\\\000\"") != std::string::npos);
+    assert(header.str().find("\"*/\\012\\000\"") != std::string::npos);
+    assert(header.str().find("\"\\303\\251\\000\"") != std::string::npos);
+
+    std::cout << "✓ Unique identifiers and escaped string literals\n" << std::endl;
+}
@@ -0,0 +1,334 @@
+#include "ll1_parser.hpp"
+#include "ll1_lexer_generator.hpp"
+#include "hulk_lexer_tables.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <cassert>
+#include <cstdlib>
+
+using namespace LL1;
+
+// Forward declarations
+std::vector<TokenRule> parseRules(const std::string& spec);
+std::vector<Token> tokenize(std::string_view input);
+int acceptedRule(const LexerDfa& dfa, const std::string& text);
+void testDfaConstruction();
+void testSpecErrors();
+void testGeneratedTablesUpToDate();
+void testLexerTokens();
+void testLexerErrors();
+void testTokenBuffer();
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - DFA Lexer" << std::endl;
+    std::cout << "========================================" << std::endl << std::endl;
+    
+    try {
+        testDfaConstruction();
+        testSpecErrors();
+        testGeneratedTablesUpToDate();
+        testLexerTokens();
+        testLexerErrors();
+        testTokenBuffer();
+        std::cout << "All tests passed! ✓" << std::endl;
+    
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
+
+std::vector<TokenRule> parseRules(const std::string& spec) {
+    std::istringstream in(spec);
+    std::vector<TokenRule> rules;
+    bool ok = LexerGenerator::parseSpec(in, rules);
+    assert(ok);
+    return rules;
+}
+
+// Los lexemas apuntan a `input`: aquí siempre son literales, que viven todo el programa
+std::vector<Token> tokenize(std::string_view input) {
+    Lexer lexer(input);
+    std::vector<Token> tokens;
+    do {
+        tokens.push_back(lexer.nextToken());
+    } while (tokens.back().kind != TokenKind::END_OF_INPUT);
+    return tokens;
+}
+
+// Regla que acepta el DFA tras leer `text` (NO_RULE si no es un estado final)
+int acceptedRule(const LexerDfa& dfa, const std::string& text) {
+    size_t state = 1;
+    for (char c : text) state = dfa.transitions[state][dfa.byteClass[static_cast<unsigned char>(c)]];
+    return dfa.accept[state];
+}
+
+void testDfaConstruction() {
+    std::cout << "=== Test: DFA construction and minimization ===" << std::endl;
+    
+    auto rules = parseRules(
+        "# comentario\n"
+        "KW   'if'\n"
+        "ID   [a-z]+\n"
+        "NUM  [0-9]+(\\.[0-9]+)?\n"
+        "OP   '<' \n"
+        "OP2  '<='\n");
+    assert(rules.size() == 5);
+    assert(rules[0].literal && rules[0].pattern == "if" && rules[0].line == 2);
+    assert(!rules[1].literal && rules[1].pattern == "[a-z]+");
+    assert(rules[3].pattern == "<");
+    
+    LexerDfa dfa = LexerGenerator::buildDfa(rules);
+    assert(acceptedRule(dfa, "if") == 0);             // a igual longitud gana la primera regla
+    assert(acceptedRule(dfa, "i") == 1);
+    assert(acceptedRule(dfa, "iff") == 1);
+    assert(acceptedRule(dfa, "12.5") == 2);
+    assert(acceptedRule(dfa, "12.") == LexerDfa::NO_RULE);
+    assert(acceptedRule(dfa, "<=") == 4);
+    assert(acceptedRule(dfa, "") == LexerDfa::NO_RULE);
+    assert(acceptedRule(dfa, "A") == LexerDfa::NO_RULE);
+    
+    // Estado muerto absorbente y clases de bytes compartidas
+    for (size_t c = 0; c < dfa.classCount; ++c) assert(dfa.transitions[0][c] == 0);
+    assert(dfa.byteClass['b'] == dfa.byteClass['z']);
+    assert(dfa.byteClass['i'] != dfa.byteClass['z']);
+    assert(dfa.byteClass['A'] == dfa.byteClass['#']);
+    
+    // Mínimo: las dos formas de escribir el mismo lenguaje dan el mismo número de estados
+    LexerDfa plain = LexerGenerator::buildDfa(parseRules("X (a|b)*abb\n"));
+    LexerDfa redundant = LexerGenerator::buildDfa(parseRules("X (a|b|a)*(ab|ab)b\n"));
+    assert(plain.stateCount() == 5);                  // muerto + los 4 estados del DFA clásico
+    assert(redundant.stateCount() == plain.stateCount());
+    
+    // Palabras reservadas: fuera del DFA, en un hash perfecto sobre la regla ID
+    auto withKeywords = parseRules("keyword KW_IF 'if'\nkeyword KW_IN  'in'\nID [a-z]+\n");
+    assert(withKeywords[0].keyword && withKeywords[0].name == "KW_IF" && withKeywords[0].pattern == "if");
+    LexerDfa identifiers = LexerGenerator::buildDfa(withKeywords);
+    assert(acceptedRule(identifiers, "if") == 2);
+    KeywordTable keywords = LexerGenerator::buildKeywordTable(withKeywords, identifiers);
+    assert(keywords.hostRule == 2);
+    assert(keywords.minLength == 2 && keywords.maxLength == 2);
+    assert(keywords.slots.size() >= 2 && (keywords.slots.size() & (keywords.slots.size() - 1)) == 0);
+    assert(std::count(keywords.slots.begin(), keywords.slots.end(), 0) == 1);
+    assert(std::count(keywords.slots.begin(), keywords.slots.end(), 1) == 1);
+    
+    std::cout << "✓ Longest match, rule priority, minimal state count and keyword hash\n" << std::endl;
+}
+
+void testSpecErrors() {
+    std::cout << "=== Test: Invalid token specifications ===" << std::endl;
+    
+    // Línea sin patrón: se reporta y parseSpec devuelve false
+    {
+        std::ostringstream errors;
+        std::streambuf* oldErr = std::cerr.rdbuf(errors.rdbuf());
+        std::istringstream in("A 'a'\nB\n");
+        std::vector<TokenRule> rules;
+        bool ok = LexerGenerator::parseSpec(in, rules);
+        std::cerr.rdbuf(oldErr);
+        assert(!ok);
+        assert(errors.str().find("line 2") != std::string::npos);
+    }
+    
+    const char* invalid[] = {
+        "A (ab\n",       // paréntesis sin cerrar
+        "A [a-\n",       // clase sin cerrar
+        "A *a\n",        // repetición sin operando
+        "A a*\n",        // acepta la cadena vacía
+        "A \\xZZ\n",     // escape hexadecimal inválido
+    };
+    for (const char* spec : invalid) {
+        bool thrown = false;
+        try {
+            LexerGenerator::buildDfa(parseRules(spec));
+        } catch (const std::runtime_error& e) {
+            thrown = std::string(e.what()).find("line 1") != std::string::npos;
+        }
+        assert(thrown);
+    }
+    
+    // Palabra reservada que la regla de identificadores no reconoce entera
+    {
+        auto rules = parseRules("keyword K 'a-b'\nID [a-z]+\n");
+        bool thrown = false;
+        try {
+            LexerGenerator::buildKeywordTable(rules, LexerGenerator::buildDfa(rules));
+        } catch (const std::runtime_error& e) {
+            thrown = std::string(e.what()).find("line 1") != std::string::npos;
+        }
+        assert(thrown);
+    }
+    
+    std::cout << "✓ Malformed patterns rejected with their spec line\n" << std::endl;
+}
+
+void testGeneratedTablesUpToDate() {
+    std::cout << "=== Test: hulk_lexer_tables.hpp matches hulk_tokens.spec ===" << std::endl;
+    
+    std::ifstream spec("hulk_tokens.spec");
+    assert(spec);
+    std::vector<TokenRule> rules;
+    bool ok = LexerGenerator::parseSpec(spec, rules);
+    assert(ok);
+    LexerDfa dfa = LexerGenerator::buildDfa(rules);
+    
+    assert(dfa.stateCount() == HulkLexer::STATE_COUNT);
+    assert(dfa.classCount == HulkLexer::CLASS_COUNT);
+    for (unsigned b = 0; b < 256; ++b) assert(dfa.byteClass[b] == HulkLexer::BYTE_CLASS[b]);
+    for (size_t s = 0; s < dfa.stateCount(); ++s) {
+        for (size_t c = 0; c < dfa.classCount; ++c) assert(dfa.transitions[s][c] == HulkLexer::TRANSITIONS[s][c]);
+        int rule = dfa.accept[s];
+        std::uint8_t expected = HulkLexer::NO_TOKEN;
+        if (rule != LexerDfa::NO_RULE && rules[rule].name == "skip") {
+            expected = HulkLexer::SKIP_TOKEN;
+        } else if (rule != LexerDfa::NO_RULE) {
+            for (size_t k = 1; k < static_cast<size_t>(TokenKind::COUNT); ++k) {
+                if (tokenKindSymbol(static_cast<TokenKind>(k)).name == rules[rule].name) expected = std::uint8_t(k);
+            }
+        }
+        assert(HulkLexer::ACCEPT[s] == expected);
+    }
+    
+    
+    // Cada palabra reservada de la especificación está en su posición del hash
+    KeywordTable keywords = LexerGenerator::buildKeywordTable(rules, dfa);
+    assert(keywords.slots.size() == sizeof(HulkLexer::KEYWORDS) / sizeof(HulkLexer::KEYWORDS[0]));
+    for (const auto& rule : rules) {
+        if (!rule.keyword) continue;
+        const char* text = rule.pattern.c_str();
+        const HulkLexer::Keyword& entry = HulkLexer::KEYWORDS[HulkLexer::keywordSlot(text, rule.pattern.size())];
+        assert(rule.pattern == entry.text);
+        assert(tokenKindSymbol(static_cast<TokenKind>(entry.kind)).name == rule.name);
+        assert(HulkLexer::classifyKeyword(text, rule.pattern.size()) == entry.kind);
+    }
+    
+    std::cout << "✓ " << HulkLexer::STATE_COUNT << " states, " << HulkLexer::CLASS_COUNT
+              << " byte classes, in sync with the spec\n" << std::endl;
+}
+
+void testLexerTokens() {
+    std::cout << "=== Test: Lexer tokens from the generated DFA ===" << std::endl;
+    
+    const std::string_view input = "let lets := 1.5 + 2. ;\n  iffy@@\"a\\n\\\"b\" <=>=";
+    auto tokens = tokenize(input);
+    const std::vector<std::pair<TokenKind, std::string>> expected = {
+        {TokenKind::LET, "let"}, {TokenKind::IDENT, "lets"}, {TokenKind::ASSIGN_DESTRUCT, ":="},
+        {TokenKind::NUMBER, "1.5"}, {TokenKind::PLUS, "+"}, {TokenKind::NUMBER, "2"},
+        {TokenKind::DOT, "."}, {TokenKind::SEMICOLON, ";"}, {TokenKind::IDENT, "iffy"},
+        {TokenKind::CONCAT, "@@"}, {TokenKind::STRING, "\"a\\n\\\"b\""}, {TokenKind::LE, "<="},
+        {TokenKind::GE, ">="}, {TokenKind::END_OF_INPUT, "$"},
+    };
+    assert(tokens.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        assert(tokens[i].kind == expected[i].first);
+        assert(tokens[i].lexeme == expected[i].second);
+    }
+    
+    // Valores y posiciones (la columna es la del primer carácter del lexema)
+    assert(tokens[3].numberValue == 1.5);
+    assert(tokens[10].stringValue() == "a\n\"b");
+    LineIndex lines(input);
+    assert(tokens[1].offset == 4 && lines.locate(tokens[1].offset).line == 1 && lines.locate(tokens[1].offset).column == 5);
+    assert(lines.locate(tokens[8].offset).line == 2 && lines.locate(tokens[8].offset).column == 3);
+    assert(tokens.back().offset == input.size() && lines.locate(tokens.back().offset).column == 22);
+    
+    // Sin copias: cada lexema es una vista sobre el propio texto de entrada
+    assert(tokens[1].lexeme.data() == input.data() + 4);
+    assert(tokens[10].lexeme.data() == input.data() + input.find('"'));
+    assert(tokens[0].stringValue().empty());
+    
+    // Cadena sin cerrar: llega hasta el final de la entrada
+    auto unterminated = tokenize("\"abc\\");
+    assert(unterminated.size() == 2 && unterminated[0].kind == TokenKind::STRING);
+    assert(unterminated[0].lexeme == "\"abc\\");
+    assert(unterminated[0].stringValue() == std::string("abc\0", 4));
+    
+    // Identificadores parecidos a palabras reservadas (prefijos, mayúsculas, misma posición del hash)
+    for (const char* identifier : {"i", "le", "lef", "lett", "In", "els", "elifs", "tru", "typo", "functions", "x", "_"}) {
+        auto single = tokenize(identifier);
+        assert(single.size() == 2 && single[0].kind == TokenKind::IDENT);
+    }
+    for (const char* keyword : {"let", "in", "if", "else", "elif", "while", "for", "function", "type",
+                                "inherits", "new", "self", "base", "true", "false"}) {
+        assert(tokenize(keyword)[0].kind != TokenKind::IDENT);
+    }
+    
+    // Mismos caracteres primero, segundo y último que una palabra reservada, otra longitud
+    for (const char* identifier : {"leet", "inn", "iff", "eelse", "whilee", "ffalse", "tyype", "neww"}) {
+        assert(tokenize(identifier)[0].kind == TokenKind::IDENT);
+    }
+    
+    // Números: el valor se convierte sobre el texto, con el mismo redondeo que strtod
+    for (const char* number : {"0", "007", "42", "3.25", "0.1", "123456789012345678901234567890",
+                               "2.2250738585072014", "9007199254740993", "1.00000000000000011102230246251565404"}) {
+        auto single = tokenize(number);
+        assert(single.size() == 2 && single[0].kind == TokenKind::NUMBER);
+        assert(single[0].numberValue == std::strtod(number, nullptr));
+    }
+    
+    std::cout << "✓ Keywords, longest match, literals and positions\n" << std::endl;
+}
+
+void testLexerErrors() {
+    std::cout << "=== Test: Lexer errors ===" << std::endl;
+    
+    const char* invalid[] = {"a ! b", "x : y", "a & b", "#", "\xC3\xA9"};
+    for (const char* input : invalid) {
+        bool thrown = false;
+        try {
+            tokenize(input);
+        } catch (const std::runtime_error& e) {
+            thrown = std::string(e.what()).rfind("Unexpected character: ", 0) == 0;
+        }
+        assert(thrown);
+    }
+    
+    // Un literal que no cabe en un double es un error léxico, no un infinito
+    bool thrown = false;
+    try {
+        tokenize("x + " + std::string(400, '9'));
+    } catch (const std::runtime_error& e) {
+        thrown = std::string(e.what()).rfind("Number out of range: 999", 0) == 0;
+    }
+    assert(thrown);
+    
+    std::cout << "✓ Bytes outside every token and oversized numbers are rejected\n" << std::endl;
+}
+
+void testTokenBuffer() {
+    std::cout << "=== Test: Token buffer (struct of arrays) ===" << std::endl;
+    
+    const std::string_view input = "let x := 1.5;\n  \"s\" @@ x";
+    auto expected = tokenize(input);
+    TokenBuffer tokens;
+    Lexer(input).tokenizeAll(tokens);
+    assert(!tokens.hasError() && tokens.size() == expected.size());
+    assert(tokens.source().data() == input.data());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        Token token = tokens.token(i);
+        assert(token.kind == expected[i].kind && tokens.kind(i) == expected[i].kind);
+        assert(token.lexeme == expected[i].lexeme && tokens.lexeme(i) == expected[i].lexeme);
+        assert(token.offset == expected[i].offset);
+    }
+    
+    // Desplazamientos y longitudes sobre la entrada; el valor de los números ya calculado
+    assert(tokens.offset(3) == 9 && tokens.length(3) == 3 && tokens.number(3) == 1.5);
+    assert(tokens.lexeme(5).data() == input.data() + input.find('"'));
+    assert(tokens.kind(tokens.size() - 1) == TokenKind::END_OF_INPUT);
+    assert(tokens.offset(tokens.size() - 1) == input.size() && tokens.lexeme(tokens.size() - 1) == "$");
+    
+    // Un error léxico corta el buffer sin lanzar; reutilizarlo empieza de cero
+    Lexer("a + ! b").tokenizeAll(tokens);
+    assert(tokens.size() == 2 && tokens.hasError());
+    assert(tokens.error() == "Unexpected character: !" && tokens.errorOffset() == 4);
+    Lexer("").tokenizeAll(tokens);
+    assert(tokens.size() == 1 && !tokens.hasError());
+    tokens.clear();
+    assert(tokens.size() == 0 && tokens.source().empty());
+    
+    std::cout << "✓ Same tokens as nextToken, stored by field\n" << std::endl;
+}
@@ -177,8 +177,8 @@ void testLexer() {
     
     for (const std::string& expected : expectedTokens) {
         Token token = lexer.nextToken();
-        std::cout << "Token: " << token.symbol.name << " (" << token.lexeme << ")" << std::endl;
-        assert(token.symbol.name == expected);
+        std::cout << "Token: " << token.symbol().name << " (" << token.lexeme << ")" << std::endl;
+        assert(token.symbol().name == expected);
     }
     
     std::cout << "✓ Lexer functionality passed\n" << std::endl;
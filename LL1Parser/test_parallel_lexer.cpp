@@ -0,0 +1,196 @@
+#include "ll1_parser.hpp"
+#include "ll1_parallel_lexer.hpp"
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <cassert>
+#include <dirent.h>
+
+using namespace LL1;
+
+// Forward declarations
+std::string randomProgram(std::mt19937& rng, size_t length, bool withErrors);
+void assertSameTokens(const TokenBuffer& expected, const TokenBuffer& actual);
+void testMatchesSequential();
+void testSpeculationFailures();
+void testWorkersPersist();
+void testParserUsesParallelLexer();
+size_t threadsInProcess();
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Parallel Lexer" << std::endl;
+    std::cout << "=============================================" << std::endl << std::endl;
+    
+    try {
+        testMatchesSequential();
+        testSpeculationFailures();
+        testWorkersPersist();
+        testParserUsesParallelLexer();
+        std::cout << "All tests passed! ✓" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
+
+// Texto con tokens de HULK, cadenas de varias líneas y con escapes y, si se pide,
+// caracteres inválidos (que fuera de una cadena son un error léxico)
+std::string randomProgram(std::mt19937& rng, size_t length, bool withErrors) {
+    static const std::vector<std::string> pieces = {
+        " ", " ", "\n", "\n", "\t", "let", "x", "variable_1", "42", "3.25", ":=", "@@", "=>",
+        "(", ")", "{", "}", ";", ".", "<=", "\"s\"", "\"a\\\"b\\\\\"", "\"una\ncadena\nlarga ; x\"",
+        "\"\\\"", "\"\"",
+    };
+    std::uniform_int_distribution<size_t> pick(0, pieces.size() - 1);
+    std::uniform_int_distribution<int> error(0, 400);
+    std::string text;
+    while (text.size() < length) {
+        text += pieces[pick(rng)];
+        if (withErrors && error(rng) == 0) text += '!';
+    }
+    return text;
+}
+
+void assertSameTokens(const TokenBuffer& expected, const TokenBuffer& actual) {
+    assert(expected.size() == actual.size());
+    assert(expected.error() == actual.error() && expected.errorOffset() == actual.errorOffset());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        Token x = expected.token(i);
+        Token y = actual.token(i);
+        assert(x.kind == y.kind && x.lexeme.data() == y.lexeme.data() && x.lexeme.size() == y.lexeme.size());
+        assert(x.offset == y.offset);
+        assert(x.numberValue == y.numberValue);
+    }
+}
+
+void testMatchesSequential() {
+    std::cout << "=== Test: Same tokens as the sequential lexer ===" << std::endl;
+    
+    std::mt19937 rng(16);
+    size_t chunked = 0;
+    size_t resynchronized = 0;
+    for (int i = 0; i < 300; ++i) {
+        const std::string input = randomProgram(rng, 50 + i * 13, i % 3 == 0);
+        TokenBuffer expected;
+        Lexer(input).tokenizeAll(expected);
+        
+        // Trozos muy pequeños para que los cortes caigan en todas partes
+        for (unsigned threads : {1u, 2u, 4u}) {
+            ParallelLexer lexer(threads, 8 + i % 40);
+            TokenBuffer actual;
+            lexer.tokenize(input, actual);
+            assertSameTokens(expected, actual);
+            chunked += lexer.lastStats().chunks > 1;
+            resynchronized += lexer.lastStats().resynchronizedChunks;
+        }
+    }
+    assert(chunked > 0 && resynchronized > 0);
+    
+    std::cout << "✓ Tokens, positions, values and errors identical\n" << std::endl;
+}
+
+void testSpeculationFailures() {
+    std::cout << "=== Test: Cuts inside tokens ===" << std::endl;
+    
+    // Una cadena con saltos de línea que ocupa varios trozos: los cortes caen dentro y
+    // la especulación empieza a contar cadenas al revés hasta resincronizar
+    std::string input = "let s := \"";
+    for (int i = 0; i < 40; ++i) input += "linea " + std::to_string(i) + " \\\" ; x\n";
+    input += "\" in s @@ \"fin\";\n";
+    for (int i = 0; i < 40; ++i) input += "x" + std::to_string(i) + " := " + std::to_string(i) + ".5;\n";
+    
+    TokenBuffer expected;
+    Lexer(input).tokenizeAll(expected);
+    ParallelLexer lexer(4, 64);
+    TokenBuffer actual;
+    lexer.tokenize(input, actual);
+    assertSameTokens(expected, actual);
+    assert(lexer.lastStats().chunks > 2);
+    assert(lexer.lastStats().resynchronizedChunks > 0 && lexer.lastStats().relexedTokens > 0);
+    
+    // Un identificador larguísimo sin saltos de línea: los cortes caen en mitad del token
+    const std::string identifier = "a + " + std::string(1000, 'b') + " + c";
+    Lexer(identifier).tokenizeAll(expected);
+    lexer.tokenize(identifier, actual);
+    assertSameTokens(expected, actual);
+    assert(actual.size() == 6 && actual.length(2) == 1000);
+    
+    // Entradas pequeñas: en secuencia
+    ParallelLexer(4).tokenize("let x := 1;", actual);
+    assert(actual.size() == 6);
+    
+    std::cout << "✓ Strings and identifiers across cuts reconciled\n" << std::endl;
+}
+
+// Hilos del proceso según /proc (0 donde no existe)
+size_t threadsInProcess() {
+    DIR* tasks = opendir("/proc/self/task");
+    if (!tasks) return 0;
+    size_t count = 0;
+    while (dirent* entry = readdir(tasks)) count += entry->d_name[0] != '.';
+    closedir(tasks);
+    return count;
+}
+
+void testWorkersPersist() {
+    std::cout << "=== Test: Worker threads reused across calls ===" << std::endl;
+    
+    std::mt19937 rng(31);
+    ParallelLexer lexer(4, 16);
+    const size_t before = threadsInProcess();
+    size_t during = 0;
+    for (int i = 0; i < 200; ++i) {
+        const std::string input = randomProgram(rng, 200 + i * 7, i % 5 == 0);
+        TokenBuffer expected;
+        Lexer(input).tokenizeAll(expected);
+        TokenBuffer actual;
+        lexer.tokenize(input, actual);
+        assertSameTokens(expected, actual);
+        assert(lexer.lastStats().chunks > 1);
+        
+        // Los tres auxiliares se crean en la primera llamada y ya no cambian
+        if (i == 0) during = threadsInProcess();
+        assert(threadsInProcess() == during);
+    }
+    assert(before == 0 || during == before + 3);
+    
+    std::cout << "✓ Three helper threads serve every call\n" << std::endl;
+}
+
+void testParserUsesParallelLexer() {
+    std::cout << "=== Test: LL1Parser with a parallel lexer ===" << std::endl;
+    
+    // Más de dos trozos del tamaño por defecto, con cadenas de varias líneas
+    std::string program;
+    while (program.size() < 3 * ParallelLexer::DEFAULT_MIN_CHUNK_SIZE) {
+        program += "let x := " + std::to_string(program.size()) + " in print(\"valor\nde x\", x);\n";
+    }
+    
+    TokenBuffer expected;
+    Lexer(program).tokenizeAll(expected);
+    ParallelLexer lexer(3);
+    assert(lexer.threadCount() == 3);
+    TokenBuffer actual;
+    lexer.tokenize(program, actual);
+    assert(lexer.lastStats().chunks > 1);
+    assertSameTokens(expected, actual);
+    
+    // El parser acepta la misma entrada con el lexer secuencial y con el paralelo
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::ostringstream sink;
+    std::streambuf* oldOut = std::cout.rdbuf(sink.rdbuf());
+    std::streambuf* oldErr = std::cerr.rdbuf(sink.rdbuf());
+    bool sequential = parser->parse(program) != nullptr;
+    parser->setLexerThreads(3);
+    bool parallel = parser->parse(program) != nullptr;
+    bool rejected = parser->parse(program + "let ! x;") == nullptr;
+    std::cout.rdbuf(oldOut);
+    std::cerr.rdbuf(oldErr);
+    assert(sequential && parallel && rejected);
+    assert(sink.str().find("Unexpected character: !") != std::string::npos);
+    
+    std::cout << "✓ Large input split across threads\n" << std::endl;
+}
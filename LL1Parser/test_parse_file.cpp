@@ -0,0 +1,177 @@
+#include "ll1_parser.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cassert>
+#include <cstdio>
+#include <thread>
+#include <unistd.h>
+#include <sys/stat.h>
+
+using namespace LL1;
+
+// Forward declarations
+std::string writeTempFile(const std::string& contents);
+bool parseCaptured(LL1Parser& parser, const std::string& path, std::string& output);
+void testSameResultAsParse();
+void testDiagnosticsWithFileAndLine();
+void testParallelLexerPositions();
+void testPipe();
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Parsing Mapped Files" << std::endl;
+    std::cout << "===================================================" << std::endl << std::endl;
+    
+    try {
+        testSameResultAsParse();
+        testDiagnosticsWithFileAndLine();
+        testParallelLexerPositions();
+        testPipe();
+        std::cout << "All tests passed! ✓" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
+
+// Archivo temporal con `contents`; el llamador lo borra
+std::string writeTempFile(const std::string& contents) {
+    char path[] = "/tmp/test_parse_file_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    std::ofstream out(path, std::ios::binary);
+    out << contents;
+    return path;
+}
+
+// parseFile con la salida (cout y cerr) capturada
+bool parseCaptured(LL1Parser& parser, const std::string& path, std::string& output) {
+    std::ostringstream captured;
+    std::streambuf* oldOut = std::cout.rdbuf(captured.rdbuf());
+    std::streambuf* oldErr = std::cerr.rdbuf(captured.rdbuf());
+    bool accepted = parser.parseFile(path) != nullptr;
+    std::cout.rdbuf(oldOut);
+    std::cerr.rdbuf(oldErr);
+    output = captured.str();
+    return accepted;
+}
+
+void testSameResultAsParse() {
+    std::cout << "=== Test: Same result as parsing the text ===" << std::endl;
+    
+    std::string program;
+    for (int i = 0; i < 500; ++i) program += "let x := " + std::to_string(i) + " in print(\"valor\\nde x\", x);\n";
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::string output;
+    for (const std::string& text : {program, std::string("print(42);"), std::string()}) {
+        const std::string path = writeTempFile(text);
+        std::ostringstream captured;
+        std::streambuf* oldOut = std::cout.rdbuf(captured.rdbuf());
+        std::streambuf* oldErr = std::cerr.rdbuf(captured.rdbuf());
+        bool fromText = parser->parse(text) != nullptr;
+        std::cout.rdbuf(oldOut);
+        std::cerr.rdbuf(oldErr);
+        bool fromFile = parseCaptured(*parser, path, output);
+        std::remove(path.c_str());
+        assert(fromText == fromFile);
+        assert(output.find(path) == std::string::npos);
+    }
+    
+    std::cout << "✓ Programs accepted and rejected alike (including the empty file)\n" << std::endl;
+}
+
+void testDiagnosticsWithFileAndLine() {
+    std::cout << "=== Test: Diagnostics with file and line ===" << std::endl;
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::string output;
+    
+    // Error sintáctico en la línea 3: el token inesperado es "in"
+    std::string path = writeTempFile("print(1);\nprint(2);\nlet x in;\n");
+    assert(!parseCaptured(*parser, path, output));
+    assert(output.find(path + ":3:7: Parse error: ") != std::string::npos);
+    std::remove(path.c_str());
+    
+    // Error léxico: la posición es la del carácter inválido
+    path = writeTempFile("print(1);\n  x ! y;\n");
+    assert(!parseCaptured(*parser, path, output));
+    assert(output.find(path + ":2:5: Parse error: Unexpected character: !") != std::string::npos);
+    std::remove(path.c_str());
+    
+    // Archivo inexistente: se informa sin intentar el análisis
+    assert(!parseCaptured(*parser, "/tmp/no_such_dir/missing.hulk", output));
+    assert(output.find("/tmp/no_such_dir/missing.hulk: Cannot read file: ") != std::string::npos);
+    assert(output.find("Parse error") == std::string::npos);
+    
+    // Tras parseFile, parse(texto) vuelve a los diagnósticos sin archivo
+    std::ostringstream captured;
+    std::streambuf* oldErr = std::cerr.rdbuf(captured.rdbuf());
+    std::streambuf* oldOut = std::cout.rdbuf(captured.rdbuf());
+    assert(!parser->parse("let x in;"));
+    std::cout.rdbuf(oldOut);
+    std::cerr.rdbuf(oldErr);
+    assert(captured.str().rfind("Parse error: ", 0) == 0);
+    
+    std::cout << "✓ Errors reported as file:line:column; missing files reported once\n" << std::endl;
+}
+
+void testParallelLexerPositions() {
+    std::cout << "=== Test: Error positions with the parallel lexer ===" << std::endl;
+    
+    // Trozos de 1 MiB: el error léxico cae en un trozo especulativo
+    std::string program;
+    int lines = 0;
+    while (program.size() < (3 << 20)) {
+        program += "let x := 1 in print(\"valor\", x);\n";
+        ++lines;
+    }
+    program += "print(1);   x ! y;\n";
+    const std::string path = writeTempFile(program);
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::string sequential;
+    std::string parallel;
+    assert(!parseCaptured(*parser, path, sequential));
+    parser->setLexerThreads(4);
+    assert(!parseCaptured(*parser, path, parallel));
+    std::remove(path.c_str());
+    
+    const std::string expected = path + ":" + std::to_string(lines + 1) + ":15: Parse error: Unexpected character: !";
+    assert(sequential.find(expected) != std::string::npos);
+    assert(parallel.find(expected) != std::string::npos);
+    
+    std::cout << "✓ Same file:line:column from sequential and parallel lexing\n" << std::endl;
+}
+
+void testPipe() {
+    std::cout << "=== Test: Files that cannot be mapped are read whole ===" << std::endl;
+    
+    // Una FIFO tiene st_size 0, pero no está vacía: se lee hasta que el escritor la cierra
+    char dir[] = "/tmp/test_parse_file_XXXXXX";
+    assert(mkdtemp(dir) != nullptr);
+    const std::string path = std::string(dir) + "/program.hulk";
+    assert(mkfifo(path.c_str(), 0600) == 0);
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::string output;
+    for (const std::string& text : {std::string("print(1);\nlet x in;\n"), std::string("print(1);\nprint(2);\n")}) {
+        std::thread writer([&path, &text]() {
+            std::ofstream out(path, std::ios::binary);
+            out << text;
+        });
+        const bool accepted = parseCaptured(*parser, path, output);
+        writer.join();
+        const bool broken = text.find("let") != std::string::npos;
+        assert(accepted == !broken);
+        assert(!broken || output.find(path + ":2:7: Parse error: ") != std::string::npos);
+    }
+    std::remove(path.c_str());
+    rmdir(dir);
+    
+    std::cout << "✓ A FIFO is parsed with its contents, not as an empty program\n" << std::endl;
+}
@@ -0,0 +1,309 @@
+#include "ll1_incremental.hpp"
+#include <iostream>
+#include <sstream>
+#include <random>
+#include <typeinfo>
+#include <cassert>
+
+using namespace LL1;
+
+// Forward declarations
+std::string buildProgram(int statements);
+std::string describe(const Program& program);
+bool sameAsFullParse(const LL1Parser& parser, const IncrementalParse& document);
+void testRandomEdits(const LL1Parser& parser, unsigned seed, int edits);
+void testSameAsFullParse();
+void testLocalEdits();
+void testStructuralEdits();
+void testBlockEdits();
+void testSemanticActions();
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Incremental Reparsing" << std::endl;
+    std::cout << "====================================================" << std::endl << std::endl;
+    
+    try {
+        testSameAsFullParse();
+        testLocalEdits();
+        testStructuralEdits();
+        testBlockEdits();
+        testSemanticActions();
+        std::cout << "All tests passed! ✓" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
+
+// Todas las formas de sentencia del nivel superior, con paréntesis y bloques anidados
+// y funciones con cuerpo de bloque (que no terminan en ';')
+std::string buildProgram(int statements) {
+    std::ostringstream program;
+    for (int i = 0; i < statements; ++i) {
+        switch (i % 7) {
+        case 0: program << "let x := " << i << ", y := (x * 2) in (x + y) * 3 - f(x, (y), 1);\n"; break;
+        case 1: program << "if (a < " << i << " || c != d) a + 1 elif (a == 0) 0 else b * c;\n"; break;
+        case 2: program << "while (i < " << i << ") g(i % 3, \"text;}\", new Point(i, 2));\n"; break;
+        case 3: program << "function h" << i << "(p, q) => p * q + " << i << " / 2;\n"; break;
+        case 4: program << "function k" << i << "(p) { let z := p in z; { p; }; }\n"; break;
+        case 5: program << "{ for (k in range(0, " << i << ")) k * k; { z; }; };\n"; break;
+        case 6: program << "print(" << i << ");\n"; break;
+        }
+    }
+    return program.str();
+}
+
+// Forma del AST para comparar Programs: tipo de cada Stmt y Expr y los valores conocidos
+std::string describe(const Program& program) {
+    std::ostringstream out;
+    for (const StmtPtr& stmt : program.stmts) {
+        if (auto exprStmt = dynamic_cast<const ExprStmt*>(stmt.get())) {
+            out << "ExprStmt(";
+            if (auto number = dynamic_cast<const NumberExpr*>(exprStmt->expr.get())) {
+                out << "NumberExpr(" << number->value << ")";
+            } else if (exprStmt->expr) {
+                out << typeid(*exprStmt->expr).name();
+            }
+            out << ");";
+        } else {
+            out << typeid(*stmt).name() << ";";
+        }
+    }
+    return out.str();
+}
+
+// El documento tiene los tokens, el resultado (con su AST) y los diagnósticos del texto
+// completo
+bool sameAsFullParse(const LL1Parser& parser, const IncrementalParse& document) {
+    TokenBuffer expected;
+    Lexer(document.text()).tokenizeAll(expected);
+    const TokenBuffer& actual = document.getTokens();
+    if (actual.size() != expected.size() || actual.error() != expected.error()) return false;
+    if (expected.hasError() && actual.errorOffset() != expected.errorOffset()) return false;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (actual.kind(i) != expected.kind(i) || actual.offset(i) != expected.offset(i) ||
+            actual.lexeme(i) != expected.lexeme(i) || actual.number(i) != expected.number(i)) {
+            return false;
+        }
+    }
+    
+    const std::vector<ParseResult> full = parser.parseMany({ParseSource::fromText(document.text(), "doc.hulk")}, 1);
+    if (document.accepted() != (full[0].program != nullptr) || document.getDiagnostics() != full[0].diagnostics) return false;
+    return !document.accepted() || describe(*document.getProgram()) == describe(*full[0].program);
+}
+
+// Ediciones al azar (insertar, borrar, sustituir) de trozos de código, cortando tokens,
+// cadenas y bloques, también el primero
+void testRandomEdits(const LL1Parser& parser, unsigned seed, int edits) {
+    static const std::vector<std::string> snippets = {
+        ";", "}", "{", "(", ")", "\"", "!", " ", "\n", "x", "12.5", "let", "in", ":=", "=>",
+        "print(1);", "{ a; }", "function f() => 1;", "/*", "*/", "// c\n", "\"a;}\"", "1 +",
+    };
+    std::mt19937 rng(seed);
+    std::unique_ptr<IncrementalParse> document = parser.parseIncremental("print(0);\n" + buildProgram(60), "doc.hulk");
+    assert(sameAsFullParse(parser, *document));
+    
+    int accepted = 0;
+    for (int k = 0; k < edits; ++k) {
+        const std::string& text = document->text();
+        TextEdit edit;
+        edit.offset = rng() % (text.size() + 1);
+        edit.removed = rng() % 3 == 0 ? 0 : std::min<size_t>(rng() % 12, text.size() - edit.offset);
+        const std::string inserted = rng() % 4 == 0 ? std::string() : snippets[rng() % snippets.size()];
+        // Quitar lo que se acaba de estropear de vez en cuando, para volver a textos válidos
+        const std::string copied = text.substr(edit.offset, edit.removed);
+        edit.inserted = inserted;
+        parser.reparse(*document, edit);
+        assert(sameAsFullParse(parser, *document));
+        accepted += document->accepted();
+        
+        if (k % 3 == 0) {
+            parser.reparse(*document, TextEdit{edit.offset, inserted.size(), copied});
+            assert(sameAsFullParse(parser, *document));
+            accepted += document->accepted();
+        }
+    }
+    assert(accepted > 0);
+}
+
+void testSameAsFullParse() {
+    std::cout << "=== Test: Same tokens, result and diagnostics as a full parse ===" << std::endl;
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    testRandomEdits(*parser, 3, 400);
+    
+    // La tabla interpretada analiza igual las sentencias sueltas
+    auto interpreter = ParserFactory::createFullHulkParserV3();
+    assert(interpreter->setGeneratedParser(nullptr, 0));
+    testRandomEdits(*interpreter, 5, 150);
+    
+    std::cout << "✓ Every random edit leaves the document as parsing its whole text would\n" << std::endl;
+}
+
+void testLocalEdits() {
+    std::cout << "=== Test: Local edits reparse only their statement ===" << std::endl;
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::unique_ptr<IncrementalParse> document = parser->parseIncremental(buildProgram(20000), "doc.hulk");
+    assert(document->accepted() && document->getDiagnostics().empty());
+    const size_t statements = document->statementCount();
+    assert(statements == 20000);
+    
+    // Cambiar un número a mitad del programa
+    const size_t middle = document->text().find("print(", document->text().size() / 2) + 6;
+    assert(parser->reparse(*document, TextEdit{middle, 1, "777"}));
+    assert(document->reparsedStatements() == 1 && document->relexedTokens() < 10);
+    assert(document->statementCount() == statements);
+    
+    // Estropearlo y arreglarlo: el diagnóstico es el del texto completo
+    assert(!parser->reparse(*document, TextEdit{middle, 0, "let in "}));
+    assert(document->reparsedStatements() == 1);
+    assert(sameAsFullParse(*parser, *document));
+    assert(document->getDiagnostics().rfind("doc.hulk:", 0) == 0);
+    assert(parser->reparse(*document, TextEdit{middle, 7, ""}));
+    assert(document->getDiagnostics().empty());
+    
+    // Insertar una sentencia entera añade una sola
+    const size_t line = document->text().rfind('\n', document->text().size() / 3) + 1;
+    assert(parser->reparse(*document, TextEdit{line, 0, "print(1); "}));
+    assert(document->statementCount() == statements + 1);
+    assert(document->reparsedStatements() <= 2);
+    assert(sameAsFullParse(*parser, *document));
+    
+    std::cout << "✓ " << statements << " statements, " << document->reparsedStatements()
+              << " reparsed after inserting one\n" << std::endl;
+}
+
+void testStructuralEdits() {
+    std::cout << "=== Test: Edits that move statement boundaries ===" << std::endl;
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    const std::string program = buildProgram(700);
+    std::unique_ptr<IncrementalParse> document = parser->parseIncremental(program, "doc.hulk");
+    const size_t line = program.rfind('\n', program.size() / 2) + 1;
+    
+    // Una llave abierta engloba todo lo que sigue; al cerrarla vuelven las sentencias
+    assert(!parser->reparse(*document, TextEdit{line, 0, "{ "}));
+    assert(sameAsFullParse(*parser, *document));
+    assert(parser->reparse(*document, TextEdit{line, 2, ""}));
+    assert(document->statementCount() == 700);
+    
+    // Un carácter que no forma ningún token: el error léxico detiene los tokens ahí
+    assert(!parser->reparse(*document, TextEdit{line, 0, "print(1 ! 2);"}));
+    assert(document->getTokens().hasError());
+    assert(sameAsFullParse(*parser, *document));
+    assert(parser->reparse(*document, TextEdit{line, 13, ""}));
+    assert(document->text() == program && sameAsFullParse(*parser, *document));
+    
+    // Todo borrado y vuelto a escribir
+    parser->reparse(*document, TextEdit{0, program.size(), ""});
+    assert(document->accepted() && document->statementCount() == 0);
+    assert(parser->reparse(*document, TextEdit{0, 0, "print(1);"}));
+    
+    bool thrown = false;
+    try {
+        parser->reparse(*document, TextEdit{5, 10, ""});
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown && document->text() == "print(1);");
+    
+    std::cout << "✓ Unclosed braces and stray characters give the full parse's diagnostics\n" << std::endl;
+}
+
+void testBlockEdits() {
+    std::cout << "=== Test: Edits inside blocks reparse only their nested statement ===" << std::endl;
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::string body;
+    for (int i = 0; i < 3000; ++i) body += "    let a := " + std::to_string(i) + " in a; { print(a); { a; }; };\n";
+    const std::string program = buildProgram(50) + "function big(p) {\n" + body + "}\n" + buildProgram(50);
+    std::unique_ptr<IncrementalParse> document = parser->parseIncremental(program, "doc.hulk");
+    assert(document->accepted() && document->statementCount() == 101);
+    
+    // Un número dentro del cuerpo, y dentro de un bloque anidado en él
+    const size_t let = document->text().find("let a := 1500 in") + 9;
+    assert(parser->reparse(*document, TextEdit{let, 4, "7"}));
+    assert(document->reparsedStatements() == 1 && document->reparsedTokens() < 10);
+    const size_t inner = document->text().find("print(a)", let) + 6;
+    assert(parser->reparse(*document, TextEdit{inner, 1, "a + 1"}));
+    assert(document->reparsedStatements() == 1 && document->reparsedTokens() < 10);
+    
+    // Estropear una sentencia anidada: el diagnóstico es el del texto completo
+    assert(!parser->reparse(*document, TextEdit{inner, 0, "let in "}));
+    assert(document->reparsedStatements() == 1 && document->reparsedTokens() < 20);
+    assert(sameAsFullParse(*parser, *document));
+    assert(parser->reparse(*document, TextEdit{inner, 7, ""}));
+    
+    // Una sentencia nueva dentro del cuerpo, y una llave que cambia los bloques
+    assert(parser->reparse(*document, TextEdit{let - 9, 0, "{ x; }; "}));
+    assert(document->reparsedStatements() <= 3 && document->reparsedTokens() < 40);
+    assert(!parser->reparse(*document, TextEdit{let - 9, 0, "{ "}));
+    assert(sameAsFullParse(*parser, *document));
+    assert(parser->reparse(*document, TextEdit{let - 9, 2, ""}));
+    assert(document->statementCount() == 101 && sameAsFullParse(*parser, *document));
+    
+    std::cout << "✓ A function body of 3000 statements keeps all but the edited one\n" << std::endl;
+}
+
+void testSemanticActions() {
+    std::cout << "=== Test: Semantic actions run only on reparsed statements ===" << std::endl;
+    
+    auto parser = ParserFactory::createFullHulkParserV4();
+    const std::string number = "DEBUG: Created NUMBER expression: ";
+    
+    // Las acciones escriben su traza directamente en cout
+    std::ostringstream trace;
+    std::streambuf* oldOut = std::cout.rdbuf(trace.rdbuf());
+    std::unique_ptr<IncrementalParse> document = parser->parseIncremental(buildProgram(70), "doc.hulk");
+    const bool first = document->accepted();
+    const size_t fullTrace = trace.str().size();
+    
+    // Cambiar el número de un print a mitad del programa
+    trace.str("");
+    const size_t middle = document->text().find("print(", document->text().size() / 2) + 6;
+    const bool edited = parser->reparse(*document, TextEdit{middle, document->text().find(')', middle) - middle, "777"});
+    const std::string editTrace = trace.str();
+    const size_t editReparsed = document->reparsedStatements();
+    const std::string editProgram = describe(*document->getProgram());
+    const std::unique_ptr<Program> editFull = parser->parse(document->text());
+    
+    // Y uno dentro de un bloque anidado
+    trace.str("");
+    const size_t inner = document->text().find("{ for (k in range(0, ", middle) + 21;
+    const bool nested = parser->reparse(*document, TextEdit{inner, document->text().find(')', inner) - inner, "888"});
+    const std::string nestedTrace = trace.str();
+    const size_t nestedReparsed = document->reparsedStatements();
+    const std::string nestedProgram = describe(*document->getProgram());
+    const std::unique_ptr<Program> nestedFull = parser->parse(document->text());
+    
+    // Estropearlo y arreglarlo
+    const bool broken = parser->reparse(*document, TextEdit{middle, 0, "let in "});
+    const std::string diagnostics = document->getDiagnostics();
+    const bool fixed = parser->reparse(*document, TextEdit{middle, 7, ""});
+    std::cout.rdbuf(oldOut);
+    
+    assert(first && edited && nested && !broken && fixed);
+    assert(diagnostics.rfind("doc.hulk:", 0) == 0);
+    
+    // Solo corren las acciones de la sentencia editada, y ven sus tokens nuevos
+    assert(editReparsed == 1 && nestedReparsed == 1);
+    assert(editTrace.find(number + "777") != std::string::npos);
+    assert(nestedTrace.find(number + "888") != std::string::npos);
+    size_t numbers = 0;
+    for (size_t at = editTrace.find(number); at != std::string::npos; at = editTrace.find(number, at + 1)) ++numbers;
+    assert(numbers == 1 && nestedTrace.size() * 20 < fullTrace);
+    
+    // El Program es el del análisis completo del texto editado
+    assert(editFull && editProgram == describe(*editFull));
+    assert(nestedFull && nestedProgram == describe(*nestedFull));
+    
+    oldOut = std::cout.rdbuf(trace.rdbuf());
+    testRandomEdits(*parser, 7, 60);
+    std::cout.rdbuf(oldOut);
+    
+    std::cout << "✓ Edits rerun the actions of their statement only and give the full parse's Program\n" << std::endl;
+}
@@ -0,0 +1,161 @@
+#include "ll1_parser.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <unistd.h>
+
+using namespace LL1;
+
+// Forward declarations
+std::string writeTempFile(const std::string& contents);
+std::vector<std::string> samplePrograms();
+void testSameAsSequentialParse();
+void testFilesAndDiagnostics();
+void testUnevenWork();
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Batch Parsing (parseMany)" << std::endl;
+    std::cout << "========================================================" << std::endl << std::endl;
+    
+    try {
+        testSameAsSequentialParse();
+        testFilesAndDiagnostics();
+        testUnevenWork();
+        std::cout << "All tests passed! ✓" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
+
+// Archivo temporal con `contents`; el llamador lo borra
+std::string writeTempFile(const std::string& contents) {
+    char path[] = "/tmp/test_parse_many_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    std::ofstream out(path, std::ios::binary);
+    out << contents;
+    return path;
+}
+
+// Programas válidos e inválidos (sintácticos y léxicos) de tamaños variados
+std::vector<std::string> samplePrograms() {
+    std::vector<std::string> programs = {"print(42);", "let x in;", "x ! y;", ""};
+    std::mt19937 rng(11);
+    for (int i = 0; i < 300; ++i) {
+        std::string program;
+        const int statements = 1 + rng() % 20;
+        for (int k = 0; k < statements; ++k) {
+            program += "let x := " + std::to_string(rng() % 100) + " in print(\"valor\", x + 1);\n";
+        }
+        if (i % 4 == 0) program.insert(rng() % program.size(), i % 8 ? ";" : "!");
+        programs.push_back(program);
+    }
+    return programs;
+}
+
+void testSameAsSequentialParse() {
+    std::cout << "=== Test: Same results and diagnostics as parse(), in input order ===" << std::endl;
+    
+    const std::vector<std::string> programs = samplePrograms();
+    std::vector<ParseSource> sources;
+    for (const std::string& program : programs) sources.push_back(ParseSource::fromText(program));
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    
+    // Referencia: parse() de cada programa, con lo que escribe en std::cerr
+    std::vector<bool> accepted;
+    std::vector<std::string> errors;
+    std::ostringstream sink;
+    std::streambuf* oldOut = std::cout.rdbuf(sink.rdbuf());
+    for (const std::string& program : programs) {
+        std::ostringstream captured;
+        std::streambuf* oldErr = std::cerr.rdbuf(captured.rdbuf());
+        accepted.push_back(parser->parse(program) != nullptr);
+        std::cerr.rdbuf(oldErr);
+        errors.push_back(captured.str());
+    }
+    std::cout.rdbuf(oldOut);
+    
+    for (unsigned threads : {1u, 3u, 8u, 0u}) {
+        // Nada se escribe en la consola: todo queda en los resultados
+        std::ostringstream console;
+        oldOut = std::cout.rdbuf(console.rdbuf());
+        std::streambuf* oldErr = std::cerr.rdbuf(console.rdbuf());
+        std::vector<ParseResult> results = parser->parseMany(sources, threads);
+        std::cout.rdbuf(oldOut);
+        std::cerr.rdbuf(oldErr);
+        assert(console.str().empty());
+        
+        assert(results.size() == programs.size());
+        for (size_t i = 0; i < results.size(); ++i) {
+            assert((results[i].program != nullptr) == accepted[i]);
+            assert(results[i].diagnostics == errors[i]);
+            assert(results[i].seconds >= 0);
+        }
+    }
+    assert(std::count(accepted.begin(), accepted.end(), false) > 0);
+    assert(parser->parseMany({}).empty());
+    
+    std::cout << "✓ " << programs.size() << " programs give parse()'s results with 1, 3, 8 and all threads\n" << std::endl;
+}
+
+void testFilesAndDiagnostics() {
+    std::cout << "=== Test: Files and per-input diagnostics ===" << std::endl;
+    
+    const std::string valid = writeTempFile("print(1);\nprint(2);\n");
+    const std::string invalid = writeTempFile("print(1);\nprint(2);\nlet x in;\n");
+    const std::string missing = "/tmp/no_such_dir/missing.hulk";
+    const std::string text = "print(1);\n  x ! y;\n";
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::vector<ParseResult> results = parser->parseMany({
+        ParseSource::fromFile(valid),
+        ParseSource::fromFile(invalid),
+        ParseSource::fromFile(missing),
+        ParseSource::fromText(text, "memoria.hulk"),
+    }, 2);
+    std::remove(valid.c_str());
+    std::remove(invalid.c_str());
+    
+    assert(results[0].program && results[0].diagnostics.empty());
+    assert(!results[1].program);
+    assert(results[1].diagnostics.rfind(invalid + ":3:7: Parse error: ", 0) == 0);
+    assert(!results[2].program);
+    assert(results[2].diagnostics.rfind(missing + ": Cannot read file: ", 0) == 0);
+    assert(!results[3].program);
+    assert(results[3].diagnostics == "memoria.hulk:2:5: Parse error: Unexpected character: !\n");
+    
+    std::cout << "✓ Each result carries its own file:line:column diagnostics\n" << std::endl;
+}
+
+void testUnevenWork() {
+    std::cout << "=== Test: Uneven inputs are shared out by stealing ===" << std::endl;
+    
+    // Todo el trabajo caro al principio: sin robo, el primer hilo lo haría solo
+    std::string large;
+    for (int i = 0; i < 20000; ++i) large += "let x := " + std::to_string(i) + " in print(x);\n";
+    std::vector<ParseSource> sources;
+    for (int i = 0; i < 8; ++i) sources.push_back(ParseSource::fromText(large));
+    for (int i = 0; i < 2000; ++i) sources.push_back(ParseSource::fromText(i % 2 ? "print(1);" : "print(1)"));
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    std::vector<ParseResult> results = parser->parseMany(sources, 4);
+    
+    assert(results.size() == sources.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        const bool expected = i < 8 || (i - 8) % 2 == 1;
+        assert((results[i].program != nullptr) == expected);
+    }
+    assert(results[0].seconds > results[9].seconds);
+    
+    std::cout << "✓ Every input parsed once, in order, whoever parsed it\n" << std::endl;
+}
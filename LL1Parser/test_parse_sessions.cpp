@@ -0,0 +1,167 @@
+#include "ll1_parser.hpp"
+#include <iostream>
+#include <sstream>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cassert>
+
+using namespace LL1;
+
+// Salida descartada: las acciones semánticas escriben en cout desde todos los hilos
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+// Forward declarations
+std::vector<std::string> samplePrograms();
+std::vector<bool> parseSequential(const LL1Parser& parser, const std::vector<std::string>& programs);
+bool parseConcurrent(const LL1Parser& parser, const std::vector<std::string>& programs,
+                     const std::vector<bool>& expected, unsigned threads, int rounds);
+void testConcurrentGeneratedParser();
+void testConcurrentInterpreter();
+void testNoStateAcrossParses();
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Concurrent Parse Sessions" << std::endl;
+    std::cout << "========================================================" << std::endl << std::endl;
+    
+    try {
+        testConcurrentGeneratedParser();
+        testConcurrentInterpreter();
+        testNoStateAcrossParses();
+        std::cout << "All tests passed! ✓" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
+
+// Programas válidos e inválidos (sintácticos y léxicos), de tamaños variados
+std::vector<std::string> samplePrograms() {
+    std::vector<std::string> programs = {
+        "print(42);",
+        "let x := 1 in print(x);",
+        "let x in;",
+        "print(1) print(2);",
+        "x ! y;",
+        "! x;",
+        "function f(a) => a + 1; print(f(2));",
+        "",
+    };
+    
+    std::mt19937 rng(7);
+    for (int i = 0; i < 40; ++i) {
+        std::string program;
+        const int statements = 1 + rng() % 30;
+        for (int k = 0; k < statements; ++k) {
+            program += "let x := " + std::to_string(rng() % 1000) + " in print(\"valor\", x * 2);\n";
+        }
+        // Uno de cada tres se estropea en un punto al azar
+        if (i % 3 == 0) program.insert(rng() % program.size(), i % 2 ? ")" : "!");
+        programs.push_back(program);
+    }
+    return programs;
+}
+
+std::vector<bool> parseSequential(const LL1Parser& parser, const std::vector<std::string>& programs) {
+    std::vector<bool> results;
+    for (const std::string& program : programs) results.push_back(parser.parse(program) != nullptr);
+    return results;
+}
+
+// `threads` hilos analizan con el mismo parser todos los programas `rounds` veces, cada
+// uno empezando por un programa distinto; devuelve si todos coinciden con `expected`
+bool parseConcurrent(const LL1Parser& parser, const std::vector<std::string>& programs,
+                     const std::vector<bool>& expected, unsigned threads, int rounds) {
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t]() {
+            for (int round = 0; round < rounds; ++round) {
+                for (size_t k = 0; k < programs.size(); ++k) {
+                    const size_t i = (k + t * 7) % programs.size();
+                    if ((parser.parse(programs[i]) != nullptr) != expected[i]) ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& thread : pool) thread.join();
+    return mismatches == 0;
+}
+
+void testConcurrentGeneratedParser() {
+    std::cout << "=== Test: One generated parser shared by several threads ===" << std::endl;
+    
+    const std::vector<std::string> programs = samplePrograms();
+    auto parser = ParserFactory::createFullHulkParserV4();
+    assert(parser->usesGeneratedParser());
+    
+    NullBuffer discard;
+    std::streambuf* oldOut = std::cout.rdbuf(&discard);
+    std::streambuf* oldErr = std::cerr.rdbuf(&discard);
+    const std::vector<bool> expected = parseSequential(*parser, programs);
+    const bool same = parseConcurrent(*parser, programs, expected, 8, 5);
+    std::cout.rdbuf(oldOut);
+    std::cerr.rdbuf(oldErr);
+    
+    assert(same);
+    assert(std::count(expected.begin(), expected.end(), true) > 0);
+    assert(std::count(expected.begin(), expected.end(), false) > 0);
+    
+    std::cout << "✓ 8 threads accept and reject exactly what a single thread does\n" << std::endl;
+}
+
+void testConcurrentInterpreter() {
+    std::cout << "=== Test: One table interpreter shared by several threads ===" << std::endl;
+    
+    const std::vector<std::string> programs = samplePrograms();
+    auto parser = ParserFactory::createFullHulkParserV3();
+    assert(parser->setGeneratedParser(nullptr, 0));
+    
+    NullBuffer discard;
+    std::streambuf* oldOut = std::cout.rdbuf(&discard);
+    std::streambuf* oldErr = std::cerr.rdbuf(&discard);
+    const std::vector<bool> expected = parseSequential(*parser, programs);
+    const bool same = parseConcurrent(*parser, programs, expected, 8, 5);
+    std::cout.rdbuf(oldOut);
+    std::cerr.rdbuf(oldErr);
+    
+    assert(same);
+    
+    std::cout << "✓ The interpreter gives the same results under concurrent use\n" << std::endl;
+}
+
+void testNoStateAcrossParses() {
+    std::cout << "=== Test: No state carried from one parse to the next ===" << std::endl;
+    
+    auto parser = ParserFactory::createFullHulkParserV4();
+    
+    // La salida de un análisis no depende de lo que se analizó antes con el mismo parser
+    auto captureParse = [&parser](const std::string& program) {
+        std::ostringstream captured;
+        std::streambuf* oldOut = std::cout.rdbuf(captured.rdbuf());
+        std::streambuf* oldErr = std::cerr.rdbuf(captured.rdbuf());
+        parser->parse(program);
+        std::cout.rdbuf(oldOut);
+        std::cerr.rdbuf(oldErr);
+        return captured.str();
+    };
+    
+    const std::string first = captureParse("print(1 + 2);");
+    captureParse("let x := 1 in print(x);");
+    captureParse("let x in;");
+    assert(captureParse("print(1 + 2);") == first);
+    
+    // Un error léxico en el primer token también es un diagnóstico, no una excepción
+    const std::string lexical = captureParse("! x;");
+    assert(lexical.find("Parse error") != std::string::npos);
+    
+    std::cout << "✓ Same output for the same program, whatever was parsed before\n" << std::endl;
+}
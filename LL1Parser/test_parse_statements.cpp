@@ -0,0 +1,219 @@
+#include "ll1_parser.hpp"
+#include "semantic_nodes.hpp"
+#include "hulk_v3_tables.hpp"
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <mutex>
+#include <cassert>
+
+using namespace LL1;
+
+// Salida (cout y cerr) de un análisis
+struct ParseOutput {
+    bool accepted;
+    std::string output;
+    std::string errors;
+};
+
+// Forward declarations
+std::string buildProgram(int statements);
+ParseOutput parseCaptured(const LL1Parser& parser, const std::string& input);
+void testSameResultAsSequential();
+void testErrorsMatchSequential();
+void testInterpreterChunks();
+void testSemanticActions();
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Parallel Top-Level Statements" << std::endl;
+    std::cout << "============================================================" << std::endl << std::endl;
+    
+    try {
+        testSameResultAsSequential();
+        testErrorsMatchSequential();
+        testInterpreterChunks();
+        testSemanticActions();
+        std::cout << "All tests passed! ✓" << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
+
+// Todas las formas de sentencia del nivel superior, con paréntesis y bloques anidados
+// y funciones con cuerpo de bloque (que no terminan en ';')
+std::string buildProgram(int statements) {
+    std::ostringstream program;
+    for (int i = 0; i < statements; ++i) {
+        switch (i % 7) {
+        case 0: program << "let x := " << i << ", y := (x * 2) in (x + y) * 3 - f(x, (y), 1);\n"; break;
+        case 1: program << "if (a < " << i << " || c != d) a + 1 elif (a == 0) 0 else b * c;\n"; break;
+        case 2: program << "while (i < " << i << ") g(i % 3, \"text;}\", new Point(i, 2));\n"; break;
+        case 3: program << "function h" << i << "(p, q) => p * q + " << i << " / 2;\n"; break;
+        case 4: program << "function k" << i << "(p) { let z := p in z; { p; }; }\n"; break;
+        case 5: program << "{ for (k in range(0, " << i << ")) k * k; { z; }; };\n"; break;
+        case 6: program << "print(" << i << ");\n"; break;
+        }
+    }
+    return program.str();
+}
+
+ParseOutput parseCaptured(const LL1Parser& parser, const std::string& input) {
+    std::ostringstream output;
+    std::ostringstream errors;
+    std::streambuf* oldOut = std::cout.rdbuf(output.rdbuf());
+    std::streambuf* oldErr = std::cerr.rdbuf(errors.rdbuf());
+    bool accepted = parser.parse(input) != nullptr;
+    std::cout.rdbuf(oldOut);
+    std::cerr.rdbuf(oldErr);
+    return {accepted, output.str(), errors.str()};
+}
+
+void testSameResultAsSequential() {
+    std::cout << "=== Test: Same result as sequential parsing ===" << std::endl;
+    
+    const std::string program = buildProgram(30000);
+    auto sequential = ParserFactory::createFullHulkParserV3();
+    auto parallel = ParserFactory::createFullHulkParserV3();
+    parallel->setStatementThreads(4);
+    
+    const ParseOutput expected = parseCaptured(*sequential, program);
+    assert(expected.accepted && expected.errors.empty());
+    for (int round = 0; round < 3; ++round) {
+        const ParseOutput actual = parseCaptured(*parallel, program);
+        assert(actual.accepted);
+        assert(actual.output == expected.output);
+        assert(actual.errors.empty());
+    }
+    
+    // Entradas pequeñas: no se parten
+    const ParseOutput small = parseCaptured(*parallel, "print(1);");
+    assert(small.accepted && small.output == parseCaptured(*sequential, "print(1);").output);
+    
+    std::cout << "✓ " << program.size() / 1024 << " KiB program accepted in parallel as sequentially\n" << std::endl;
+}
+
+void testErrorsMatchSequential() {
+    std::cout << "=== Test: Errors reported as in sequential parsing ===" << std::endl;
+    
+    const std::string program = buildProgram(30000);
+    auto sequential = ParserFactory::createFullHulkParserV3();
+    auto parallel = ParserFactory::createFullHulkParserV3();
+    parallel->setStatementThreads(4);
+    
+    // Errores al principio, en medio y al final; llaves y paréntesis sin cerrar o de más;
+    // un bloque sin ';' que el corte tomaría por el final de una función
+    const std::vector<std::pair<size_t, std::string>> edits = {
+        {0, "let in"},
+        {program.size() / 2, "print(1"},
+        {program.size() / 3, "{ x; }"},
+        {program.size() / 4, ")"},
+        {program.size() * 2 / 3, "}"},
+        {program.size(), "print(1)"},
+        {program.size(), "{"},
+    };
+    for (const auto& edit : edits) {
+        std::string broken = program;
+        // Insertar al principio de una línea, para no partir un token
+        const size_t at = edit.first == 0 || edit.first == program.size() ? edit.first : program.rfind('\n', edit.first) + 1;
+        broken.insert(at, edit.second);
+        
+        const ParseOutput expected = parseCaptured(*sequential, broken);
+        const ParseOutput actual = parseCaptured(*parallel, broken);
+        assert(!expected.accepted && !actual.accepted);
+        assert(actual.errors == expected.errors);
+        assert(actual.output == expected.output);
+    }
+    
+    std::cout << "✓ Same diagnostics for " << edits.size() << " broken programs\n" << std::endl;
+}
+
+void testInterpreterChunks() {
+    std::cout << "=== Test: Chunks parsed by the table interpreter ===" << std::endl;
+    
+    std::string program = buildProgram(20000);
+    auto parser = ParserFactory::createFullHulkParserV3();
+    assert(parser->setGeneratedParser(nullptr, 0));
+    parser->setStatementThreads(3);
+    assert(parseCaptured(*parser, program).accepted);
+    
+    program.insert(program.rfind('\n', program.size() / 2) + 1, "let x := ;");
+    auto sequential = ParserFactory::createFullHulkParserV3();
+    sequential->setGeneratedParser(nullptr, 0);
+    const ParseOutput actual = parseCaptured(*parser, program);
+    assert(!actual.accepted);
+    assert(actual.errors == parseCaptured(*sequential, program).errors);
+    
+    std::cout << "✓ Interpreter accepts and rejects the same programs in parallel\n" << std::endl;
+}
+
+void testSemanticActions() {
+    std::cout << "=== Test: Semantic actions keep the sequential parse ===" << std::endl;
+    
+    // Cada sentencia (también las de los bloques) anota dónde empieza y apila un Stmt con ese offset
+    std::mutex mutex;
+    auto markStatements = [&](LL1Parser& parser, std::vector<std::uint32_t>& log) {
+        const CompiledGrammar& grammar = parser.getGrammar();
+        for (size_t p = 0; p < grammar.productionCount(); ++p) {
+            if (grammar.lhs(int(p)) != HulkV3::NT_STMT) continue;
+            parser.setSemanticAction(int(p), [&mutex, &log](const std::vector<Token>& tokens, std::stack<std::unique_ptr<SemanticNode>>& stack) {
+                std::lock_guard<std::mutex> lock(mutex);
+                log.push_back(tokens[0].offset);
+                stack.push(std::make_unique<StmtSemanticNode>(std::make_unique<ExprStmt>(std::make_unique<NumberExpr>(tokens[0].offset))));
+            });
+        }
+    };
+    auto statementOffsets = [](const Program& program) {
+        std::vector<std::uint32_t> result;
+        for (const auto& stmt : program.stmts) {
+            const auto* exprStmt = dynamic_cast<const ExprStmt*>(stmt.get());
+            const auto* number = exprStmt ? dynamic_cast<const NumberExpr*>(exprStmt->expr.get()) : nullptr;
+            assert(number);
+            result.push_back(std::uint32_t(number->value));
+        }
+        return result;
+    };
+    
+    const int statements = 3000;
+    const std::string program = buildProgram(statements);
+    std::vector<std::uint32_t> topLevel;
+    for (size_t start = 0; start < program.size(); start = program.find('\n', start) + 1) topLevel.push_back(std::uint32_t(start));
+    
+    std::vector<std::uint32_t> sequentialLog, parallelLog, interpreterLog;
+    auto sequential = ParserFactory::createFullHulkParserV3();
+    auto parallel = ParserFactory::createFullHulkParserV3();
+    auto interpreter = ParserFactory::createFullHulkParserV3();
+    assert(interpreter->setGeneratedParser(nullptr, 0));
+    parallel->setStatementThreads(4);
+    interpreter->setStatementThreads(3);
+    markStatements(*sequential, sequentialLog);
+    markStatements(*parallel, parallelLog);
+    markStatements(*interpreter, interpreterLog);
+    
+    std::ostringstream output;
+    std::streambuf* oldOut = std::cout.rdbuf(output.rdbuf());
+    std::unique_ptr<Program> expected = sequential->parse(program);
+    std::unique_ptr<Program> actual = parallel->parse(program);
+    std::unique_ptr<Program> interpreted = interpreter->parse(program);
+    std::cout.rdbuf(oldOut);
+    
+    // Con acciones el análisis es el secuencial: las acciones corren una vez por sentencia,
+    // anidadas incluidas, en el orden del texto
+    assert(expected && actual && interpreted);
+    assert(int(sequentialLog.size()) > statements);
+    assert(std::is_sorted(sequentialLog.begin(), sequentialLog.end()));
+    assert(parallelLog == sequentialLog);
+    assert(interpreterLog == sequentialLog);
+    
+    // El Program tiene el mismo contenido y solo sentencias del nivel superior
+    const std::vector<std::uint32_t> stmts = statementOffsets(*expected);
+    assert(statementOffsets(*actual) == stmts);
+    assert(statementOffsets(*interpreted) == stmts);
+    assert(stmts.size() <= topLevel.size());
+    for (std::uint32_t offset : stmts) assert(std::binary_search(topLevel.begin(), topLevel.end(), offset));
+    
+    std::cout << "✓ " << sequentialLog.size() << " statement actions run in order, " << stmts.size() << " top-level statements in the Program\n" << std::endl;
+}
@@ -0,0 +1,184 @@
+#include "ll1_parser.hpp"
+#include "ll1_streaming_lexer.hpp"
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <cassert>
+#include <unistd.h>
+
+using namespace LL1;
+
+// Token copiado, con su línea y columna (el lexema y el offset de un token del
+// StreamingLexer solo valen hasta el siguiente)
+struct TokenCopy {
+    TokenKind kind;
+    std::string lexeme;
+    int line;
+    int column;
+    double number;
+    
+    bool operator==(const TokenCopy& other) const {
+        return kind == other.kind && lexeme == other.lexeme && line == other.line &&
+               column == other.column && number == other.number;
+    }
+};
+
+// Forward declarations
+std::string randomProgram(std::mt19937& rng, size_t length);
+std::vector<TokenCopy> lexAll(std::string_view input);
+std::vector<TokenCopy> lexStreaming(InputSource& input, size_t bufferSize, size_t* capacity = nullptr);
+void testMatchesWholeInputLexer();
+void testBoundedBuffer();
+void testParseFromPipe();
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Streaming Lexer" << std::endl;
+    std::cout << "==============================================" << std::endl << std::endl;
+    
+    try {
+        testMatchesWholeInputLexer();
+        testBoundedBuffer();
+        testParseFromPipe();
+        std::cout << "All tests passed! ✓" << std::endl;
+    
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
+
+std::string randomProgram(std::mt19937& rng, size_t length) {
+    static const std::vector<std::string> pieces = {
+        " ", "\n", "\t  ", "let", "x", "identificador_largo", "42", "3.25", "7.", ":=", "@@", "=>",
+        "=", "==", "<", "<=", "!=", "|", "||", "(", ")", ";", ".", "\"s\"", "\"a\\\"b\\\\\"",
+        "\"dos\nlineas\"", "\"\\", "!",
+    };
+    std::uniform_int_distribution<size_t> pick(0, pieces.size() - 1);
+    std::string text;
+    while (text.size() < length) text += pieces[pick(rng)];
+    return text;
+}
+
+// Tokens hasta END_OF_INPUT; un error léxico se añade como un token COUNT con el mensaje
+std::vector<TokenCopy> lexAll(std::string_view input) {
+    Lexer lexer(input);
+    LineIndex lines(input);
+    std::vector<TokenCopy> tokens;
+    try {
+        for (;;) {
+            Token token = lexer.nextToken();
+            SourcePosition position = lines.locate(token.offset);
+            tokens.push_back({token.kind, std::string(token.lexeme), position.line, position.column, token.numberValue});
+            if (token.kind == TokenKind::END_OF_INPUT) break;
+        }
+    } catch (const std::runtime_error& e) {
+        tokens.push_back({TokenKind::COUNT, e.what(), 0, 0, 0.0});
+    }
+    return tokens;
+}
+
+std::vector<TokenCopy> lexStreaming(InputSource& input, size_t bufferSize, size_t* capacity) {
+    StreamingLexer lexer(input, bufferSize);
+    std::vector<TokenCopy> tokens;
+    try {
+        for (;;) {
+            Token token = lexer.nextToken();
+            SourcePosition position = lexer.locate(token.offset);
+            tokens.push_back({token.kind, std::string(token.lexeme), position.line, position.column, token.numberValue});
+            if (token.kind == TokenKind::END_OF_INPUT) break;
+        }
+    } catch (const std::runtime_error& e) {
+        tokens.push_back({TokenKind::COUNT, e.what(), 0, 0, 0.0});
+    }
+    if (capacity) *capacity = lexer.bufferCapacity();
+    return tokens;
+}
+
+void testMatchesWholeInputLexer() {
+    std::cout << "=== Test: Same tokens as the whole-input lexer ===" << std::endl;
+    
+    // Buffers diminutos: casi todos los tokens cruzan un relleno
+    std::mt19937 rng(17);
+    for (int i = 0; i < 200; ++i) {
+        const std::string input = randomProgram(rng, i * 5);
+        auto expected = lexAll(input);
+        for (size_t bufferSize : {1, 2, 3, 7, 64}) {
+            std::istringstream in(input);
+            StreamSource source(in);
+            assert(lexStreaming(source, bufferSize) == expected);
+        }
+    }
+    
+    std::cout << "✓ Tokens, positions, values and errors identical with 1..64 byte buffers\n" << std::endl;
+}
+
+void testBoundedBuffer() {
+    std::cout << "=== Test: Bounded buffer ===" << std::endl;
+    
+    // Mucha entrada y tokens cortos: el buffer no crece
+    std::string program;
+    while (program.size() < (1 << 20)) program += "let x := 12.5 in print(\"hola\", x);\n";
+    std::istringstream in(program);
+    StreamSource source(in);
+    size_t capacity = 0;
+    auto tokens = lexStreaming(source, 256, &capacity);
+    assert(capacity == 256);
+    assert(tokens.back().kind == TokenKind::END_OF_INPUT);
+    assert(tokens.size() == lexAll(program).size());
+    
+    // Un lexema más largo que el buffer lo agranda lo justo para contenerlo
+    const std::string longString = "x @@ \"" + std::string(10000, 's') + "\" @@ y";
+    std::istringstream longIn(longString);
+    StreamSource longSource(longIn);
+    auto longTokens = lexStreaming(longSource, 16, &capacity);
+    assert(longTokens == lexAll(longString));
+    assert(longTokens[2].lexeme.size() == 10002);
+    assert(capacity >= 10002 && capacity < 2 * 10002 + 16);
+    
+    std::cout << "✓ 256-byte buffer for 1 MiB of input; grows only for longer lexemes\n" << std::endl;
+}
+
+void testParseFromPipe() {
+    std::cout << "=== Test: Parsing from a pipe ===" << std::endl;
+    
+    std::string program;
+    for (int i = 0; i < 2000; ++i) program += "let x := " + std::to_string(i) + " in print(\"valor\", x);\n";
+    
+    auto parser = ParserFactory::createFullHulkParserV3();
+    auto parseFromPipe = [&parser](const std::string& text) {
+        int fds[2];
+        int created = pipe(fds);
+        assert(created == 0);
+        std::thread writer([&text, fds] {
+            for (size_t written = 0; written < text.size();) {
+                ssize_t count = write(fds[1], text.data() + written, std::min<size_t>(4096, text.size() - written));
+                assert(count > 0);
+                written += static_cast<size_t>(count);
+            }
+            close(fds[1]);
+        });
+        FileDescriptorSource source(fds[0]);
+        bool accepted = parser->parse(source, 512) != nullptr;
+        writer.join();
+        close(fds[0]);
+        return accepted;
+    };
+    
+    std::ostringstream captured;
+    std::streambuf* oldOut = std::cout.rdbuf(captured.rdbuf());
+    std::streambuf* oldErr = std::cerr.rdbuf(captured.rdbuf());
+    bool whole = parser->parse(program) != nullptr;
+    bool streamed = parseFromPipe(program);
+    bool syntaxError = parseFromPipe(program + "let x in;");
+    bool lexicalError = parseFromPipe(program + "x ! y;");
+    std::cout.rdbuf(oldOut);
+    std::cerr.rdbuf(oldErr);
+    
+    assert(whole && streamed && !syntaxError && !lexicalError);
+    assert(captured.str().find("Unexpected character: !") != std::string::npos);
+    
+    std::cout << "✓ Same result reading a pipe through a 512-byte buffer\n" << std::endl;
+}
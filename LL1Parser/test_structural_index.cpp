@@ -0,0 +1,217 @@
+#include "ll1_parser.hpp"
+#include "ll1_structural_index.hpp"
+#include <iostream>
+#include <random>
+#include <cctype>
+#include <cassert>
+
+using namespace LL1;
+
+// Forward declarations
+std::string randomText(std::mt19937& rng, size_t length);
+std::vector<Token> tokenize(std::string_view input, bool indexed, StructuralIndex::Isa isa);
+void testBlockMasks();
+void testIsaAgreement();
+void testQueries();
+void testIndexedLexer();
+void testLineIndex();
+
+const StructuralIndex::Isa ALL_ISAS[] = {
+    StructuralIndex::Isa::SCALAR, StructuralIndex::Isa::SSE2, StructuralIndex::Isa::AVX2,
+};
+
+int main() {
+    std::cout << "LL(1) Parser Generator Tests - Structural Index" << std::endl;
+    std::cout << "===============================================" << std::endl << std::endl;
+    
+    try {
+        testBlockMasks();
+        testIsaAgreement();
+        testQueries();
+        testIndexedLexer();
+        testLineIndex();
+        std::cout << "All tests passed! ✓" << std::endl;
+    
+    } catch (const std::exception& e) {
+        std::cerr << "Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
+
+// Texto aleatorio con tokens de HULK, bytes altos y nulos
+std::string randomText(std::mt19937& rng, size_t length) {
+    static const std::string pieces[] = {
+        " ", "\n", "\t", "x", "let", "_a1", "42", "3.25", "\"s\"", "\"a\\\"b\"", "\\", ":=", "@@",
+        "(", ")", "{", "}", ";", ".", "<=", "!", std::string(1, '\0'), "\xC3\xA9", "\x7F", "\xFF",
+    };
+    std::uniform_int_distribution<size_t> pick(0, sizeof(pieces) / sizeof(pieces[0]) - 1);
+    std::string text;
+    while (text.size() < length) text += pieces[pick(rng)];
+    text.resize(length);
+    return text;
+}
+
+// Tokens de la entrada con o sin índice; un error léxico se añade como un token COUNT
+// final (para comparar también dónde falla)
+std::vector<Token> tokenize(std::string_view input, bool indexed, StructuralIndex::Isa isa) {
+    Lexer lexer(input);
+    if (indexed) lexer.useStructuralIndex(isa);
+    std::vector<Token> tokens;
+    try {
+        do {
+            tokens.push_back(lexer.nextToken());
+        } while (tokens.back().kind != TokenKind::END_OF_INPUT);
+    } catch (const std::runtime_error&) {
+        tokens.emplace_back(TokenKind::COUNT, "error");
+    }
+    return tokens;
+}
+
+void testBlockMasks() {
+    std::cout << "=== Test: Block masks ===" << std::endl;
+    
+    const std::string text = "let x1 := \"a\\\"\";\n\t@@ 7";
+    StructuralIndex index(text, StructuralIndex::Isa::SCALAR);
+    assert(index.size() == text.size() && index.blocks().size() == 1);
+    
+    const StructuralBlock& block = index.blocks()[0];
+    auto bits = [&text](bool (*member)(char)) {
+        std::uint64_t mask = 0;
+        for (size_t i = 0; i < text.size(); ++i) mask |= std::uint64_t(member(text[i])) << i;
+        return mask;
+    };
+    assert(block.whitespace == bits([](char c) { return c == ' ' || c == '\n' || c == '\t'; }));
+    assert(block.identifier == bits([](char c) { return std::isalnum(static_cast<unsigned char>(c)) != 0; }));
+    assert(block.digit == bits([](char c) { return c >= '0' && c <= '9'; }));
+    assert(block.quote == bits([](char c) { return c == '"'; }));
+    assert(block.backslash == bits([](char c) { return c == '\\'; }));
+    assert(block.nul == 0);
+    assert(block.operators == bits([](char c) { return c == ':' || c == '=' || c == ';' || c == '@'; }));
+    
+    // Los bits posteriores al final del texto quedan a cero aunque el relleno sea '\0'
+    assert((block.whitespace | block.identifier | block.nul) >> text.size() == 0);
+    assert(StructuralIndex("", StructuralIndex::Isa::SCALAR).blocks().empty());
+    
+    std::cout << "✓ One bit per byte and class, padding cleared\n" << std::endl;
+}
+
+void testIsaAgreement() {
+    std::cout << "=== Test: SIMD passes match the scalar reference ===" << std::endl;
+    
+    std::mt19937 rng(2024);
+    std::string all;
+    for (int c = 0; c < 256; ++c) all += char(c);
+    std::vector<std::string> inputs = {all, all + all.substr(0, 37)};
+    for (size_t length : {1, 15, 16, 31, 32, 63, 64, 65, 127, 128, 1000}) inputs.push_back(randomText(rng, length));
+    
+    size_t checked = 0;
+    for (auto isa : ALL_ISAS) {
+        if (!StructuralIndex::isSupported(isa)) continue;
+        ++checked;
+        for (const std::string& text : inputs) {
+            StructuralIndex reference(text, StructuralIndex::Isa::SCALAR);
+            StructuralIndex simd(text, isa);
+            assert(simd.isa() == isa);
+            assert(simd.blocks().size() == reference.blocks().size());
+            for (size_t b = 0; b < simd.blocks().size(); ++b) {
+                const StructuralBlock& x = simd.blocks()[b];
+                const StructuralBlock& y = reference.blocks()[b];
+                assert(x.whitespace == y.whitespace);
+                assert(x.identifier == y.identifier && x.digit == y.digit);
+                assert(x.quote == y.quote && x.backslash == y.backslash);
+                assert(x.nul == y.nul && x.operators == y.operators);
+            }
+        }
+        std::cout << "  " << StructuralIndex::isaName(isa) << ": same masks" << std::endl;
+    }
+    assert(checked >= 1);
+    
+    std::cout << "✓ Every supported ISA agrees with SCALAR\n" << std::endl;
+}
+
+void testQueries() {
+    std::cout << "=== Test: Index queries ===" << std::endl;
+    
+    // Un identificador y un bloque de espacios que cruzan la frontera de 64 bytes
+    std::string text = std::string(60, ' ') + "abc_123" + std::string(70, '\n') + "\"xy\\\"z\"";
+    StructuralIndex index(text);
+    assert(index.skipWhitespace(0) == 60);
+    assert(index.skipWhitespace(60) == 60);
+    assert(index.skipIdentifier(60) == 67);
+    assert(index.skipDigits(64) == 67);
+    assert(index.skipWhitespace(67) == 137);
+    assert(index.findStringSpecial(138) == 140);
+    assert(index.findStringSpecial(141) == 141);
+    assert(index.findStringSpecial(142) == 143);
+    assert(index.findStringSpecial(text.size()) == text.size());
+    assert(index.skipIdentifier(text.size()) == text.size());
+    
+    // Un identificador que llega justo hasta el final de la entrada
+    StructuralIndex tail(std::string(64, 'a'));
+    assert(tail.skipIdentifier(3) == 64);
+    
+    std::cout << "✓ Skips and string specials across blocks\n" << std::endl;
+}
+
+void testIndexedLexer() {
+    std::cout << "=== Test: Lexer with and without the index ===" << std::endl;
+    
+    std::mt19937 rng(7);
+    std::vector<std::string> inputs = {
+        "let x := 1.5 + 2. ;\n  iffy@@\"a\\n\\\"b\" <=>=",
+        std::string(100, ' ') + "identificador_muy_largo_que_cruza_el_bloque_" + std::string(40, 'z') + " 1234567890.25",
+        "\"" + std::string(200, 's') + "\\\"" + std::string(100, '\n') + "\" tail",
+        "\"abc\\",
+        "\"sin cerrar\n" + std::string(80, 'x'),
+    };
+    for (int i = 0; i < 200; ++i) inputs.push_back(randomText(rng, 1 + i * 7));
+    
+    for (auto isa : ALL_ISAS) {
+        if (!StructuralIndex::isSupported(isa)) continue;
+        for (const std::string& text : inputs) {
+            auto plain = tokenize(text, false, isa);
+            auto indexed = tokenize(text, true, isa);
+            assert(plain.size() == indexed.size());
+            for (size_t i = 0; i < plain.size(); ++i) {
+                assert(plain[i].kind == indexed[i].kind);
+                assert(plain[i].lexeme == indexed[i].lexeme);
+                assert(plain[i].offset == indexed[i].offset);
+                if (plain[i].kind == TokenKind::NUMBER) assert(plain[i].numberValue == indexed[i].numberValue);
+            }
+        }
+    }
+    
+    std::cout << "✓ Same tokens, values, errors and positions\n" << std::endl;
+}
+
+void testLineIndex() {
+    std::cout << "=== Test: Line index ===" << std::endl;
+    
+    // Referencia: recorrer byte a byte como hacía el Lexer
+    std::mt19937 rng(20);
+    std::vector<std::string> inputs = {"", "\n", "abc", "\n\n\nx", std::string(64, '\n'), std::string(63, 'a') + "\nb"};
+    for (int i = 0; i < 100; ++i) inputs.push_back(randomText(rng, 1 + i * 11));
+    
+    for (auto isa : ALL_ISAS) {
+        if (!StructuralIndex::isSupported(isa)) continue;
+        for (const std::string& text : inputs) {
+            LineIndex lines(text, isa);
+            SourcePosition expected;
+            for (size_t offset = 0; offset <= text.size(); ++offset) {
+                SourcePosition position = lines.locate(offset);
+                assert(position.line == expected.line && position.column == expected.column);
+                if (offset < text.size() && text[offset] == '\n') {
+                    ++expected.line;
+                    expected.column = 1;
+                } else {
+                    ++expected.column;
+                }
+            }
+            assert(lines.lineCount() == size_t(expected.line));
+        }
+    }
+    
+    std::cout << "✓ Offsets mapped to line and column like a byte-by-byte scan\n" << std::endl;
+}